@@ -0,0 +1,443 @@
+/// @file adc_capture.c
+/// @brief AD9648 sample capture through DCMI and DMA2 ping-pong buffers
+///
+/// The AD9648 parallel output is clocked into the DCMI in 14-bit mode, one converter
+/// word per PIXCLK, two words (channel A and channel B of the multiplexed output) per
+/// 32-bit DCMI data word. DMA2 moves the data words in circular mode over a buffer of
+/// two chirps: the half transfer interrupt hands the first half (ping) to the consumer
+/// while the second half (pong) fills, the transfer complete interrupt the other way
+/// round. The CPU only runs once per chirp.
+///
+/// Overruns are detected at both ends: the DCMI FIFO overflow flag when the DMA falls
+/// behind the converter, and a buffer half completing while the half the DMA has
+/// moved on to is still held by the consumer.
+///
+/// In ramp trigger mode the ADF4159 MUXOUT is programmed to ramp complete and its
+/// EXTI line is taken over from the lock detector. The DMA is armed at the start but
+/// the DCMI capture is only enabled by the first ramp complete edge, so every frame
+/// starts at the same phase of the sweep. Each following edge timestamps the chirp
+/// it starts and checks the DMA position at the edge: the position read in the ISR less
+/// the pairs converted since the edge, timed from the EXTI timestamp plus the nominal
+/// interrupt latency. An edge more than ADC_CAPTURE_ALIGN_SLIP sample pairs away from a
+/// half boundary restarts the capture on that edge. The edges
+/// are numbered, each chirp carries the number of the ramp it belongs to, so a ramp
+/// lost to a restart does not shift the up/down order of a triangular ramp.
+///
+/// PIXCLK is limited to 54 MHz, i.e. 27 MSPS per channel with the multiplexed output.
+///
+/// The stock OLIMEX_STM32_E407 board file does not set up the DCMI, the back end puts
+/// its pins on AF13 at start. Pin plan on the LQFP144, clear of the MUXOUT inputs
+/// (PE2/PE3), the Ethernet RMII pins and USART6 (PC6/PC7, the report port):
+///
+///   PIXCLK PA6    VSYNC PB7    HSYNC not connected (PA4 is the SPI1 chip select)
+///   D0  PA9       D1  PA10     D2  PE0      D3  PE1      D4  PE4      D5  PB6
+///   D6  PE5       D7  PE6      D8  PC10     D9  PC12     D10 PD6      D11 PD2
+///   D12 PF11      D13 PG15
+///
+/// D0/D1 exist only on PC6/PC7 or PA9/PA10, the E407 wires PA9/PA10 to the USB OTG FS
+/// VBUS and ID lines, so the OTG1 port must stay unused. D8, D9 and D11 exist only on
+/// PC10, PC12 and PD2, shared with the microSD card, which must stay unused. PIXCLK
+/// exists only on PA6, so SPI1 must use its PB3/PB4/PB5 mapping.
+///
+/// @author Peter Ludlow
+
+#include <string.h>
+#include "ch.h"
+#include "hal.h"
+#include "adc_capture.h"
+#include "fft.h"
+#include "lock_detect.h"
+#include "timing_probe.h"
+
+
+/*===============================================================*/
+/*Capture State                                                  */
+/*===============================================================*/
+
+// Two chirps of sample pairs, main SRAM as the CCM is not reachable by the DMA
+static adc_sample_t capture_buf[2U * ADC_CAPTURE_MAX_SAMPLES] __attribute__((aligned(4)));
+
+static struct {
+    const adc_capture_config_t *cfg;    // Active configuration, NULL when stopped
+    uint32_t samples;                   // Sample pairs per half
+    uint32_t chirp;                     // Chirp number of the next half delivered
+    uint8_t  held;                      // Bit per half owned by the consumer
+    rtcnt_t  handed[2];                 // Time each half was handed to the consumer
+    rtcnt_t  stamp[2];                  // Start time of the chirp in each half
+    uint32_t ramp[2];                   // Ramp number of the chirp in each half
+    uint32_t edges;                     // Ramp complete edges since the start
+    bool     triggered;                 // First ramp complete edge seen
+} capture;
+
+static adc_capture_stats_t stats;
+
+
+/*
+ *@brief  Hands a completed buffer half to the consumer, called by the back end
+ *@note   I-class, the back end is already filling the other half
+ */
+
+void adc_capture_half_doneI(uint8_t half){
+
+    adc_chirp_t c;
+    rtcnt_t now = TIMING_PROBE_NOW();
+
+    if ((capture.held & (1U << (half ^ 1U))) != 0U) {
+        stats.overruns++;
+    }
+
+    // Without ramp edges the other half starts now
+    if (!capture.cfg->ramp_trigger) {
+        capture.stamp[half ^ 1U] = now;
+        capture.ramp[half ^ 1U] = capture.chirp + 1U;
+    }
+
+    capture.held |= (uint8_t)(1U << half);
+    capture.handed[half] = now;
+    stats.chirps++;
+    stats.samples += capture.samples;
+
+    c.buf   = &capture_buf[half * capture.samples];
+    c.n     = capture.samples;
+    c.chirp = capture.chirp++;
+    c.ramp  = capture.ramp[half];
+    c.stamp = capture.stamp[half];
+    capture.cfg->cb(&c);
+}
+
+/*
+ *@brief  Ramp complete edge, called by the back end with the edge timestamp
+ *@note   I-class, the first edge starts the capture, later edges timestamp and align the chirps
+ */
+
+void adc_capture_ramp_edgeI(rtcnt_t stamp){
+
+    uint32_t n = capture.samples;
+    uint32_t pos;
+    uint32_t slip;
+    uint8_t half;
+
+    if ((capture.cfg == NULL) || !capture.cfg->ramp_trigger) {
+        return;
+    }
+
+    stats.triggers++;
+
+    if (!capture.triggered) {
+        capture.triggered = true;
+        capture.stamp[0] = stamp;
+        capture.ramp[0] = capture.edges++;
+        adc_capture_lld_trigger();
+        return;
+    }
+
+    // The chirp starting now goes to the half nearest to the DMA position at the edge, early or late
+    pos  = adc_capture_lld_position(stamp);
+    half = (uint8_t)(((pos + (n / 2U)) / n) & 1U);
+    slip = pos % n;
+    if (slip > (n / 2U)) {
+        slip = n - slip;
+    }
+
+    if (slip > stats.max_slip) {
+        stats.max_slip = slip;
+    }
+
+    if (slip > ADC_CAPTURE_ALIGN_SLIP) {
+        stats.realigns++;
+        adc_capture_lld_restart();
+        half = 0U;
+    }
+
+    capture.stamp[half] = stamp;
+    capture.ramp[half] = capture.edges++;
+}
+
+/*
+ *@brief  Starts the capture, one callback per chirp of cfg->samples sample pairs
+ */
+
+void adc_capture_start(const adc_capture_config_t *cfg){
+
+    osalDbgCheck((cfg != NULL) && (cfg->cb != NULL));
+    osalDbgCheck((cfg->samples > 0U) && (cfg->samples <= ADC_CAPTURE_MAX_SAMPLES));
+    osalDbgAssert(capture.cfg == NULL, "capture running");
+
+    capture.cfg       = cfg;
+    capture.samples   = cfg->samples;
+    capture.chirp     = 0U;
+    capture.held      = 0U;
+    capture.triggered = false;
+    capture.edges     = 0U;
+    capture.ramp[0]   = 0U;
+    capture.stamp[0]  = TIMING_PROBE_NOW();
+
+    adc_capture_lld_start(capture_buf, cfg);
+}
+
+/*
+ *@brief  Stops the capture, no callback is made after the return
+ */
+
+void adc_capture_stop(void){
+
+    if (capture.cfg == NULL) {
+        return;
+    }
+
+    adc_capture_lld_stop();
+    capture.cfg = NULL;
+}
+
+/*
+ *@brief  Returns a buffer half handed to the chirp callback
+ *@note   I-class, may be called from the chirp callback itself
+ */
+
+void adc_capture_releaseI(const adc_sample_t *buf){
+
+    uint8_t half = (buf == capture_buf) ? 0U : 1U;
+    rtcnt_t hold;
+
+    osalDbgAssert((capture.held & (1U << half)) != 0U, "half not held");
+
+    capture.held &= (uint8_t)~(1U << half);
+    hold = TIMING_PROBE_NOW() - capture.handed[half];
+    if (hold > stats.max_hold) {
+        stats.max_hold = hold;
+    }
+}
+
+/*
+ *@brief  Returns a buffer half handed to the chirp callback, thread context
+ */
+
+void adc_capture_release(const adc_sample_t *buf){
+
+    osalSysLock();
+    adc_capture_releaseI(buf);
+    osalSysUnlock();
+}
+
+/*
+ *@brief  Converts a held half from offset binary sample pairs to Q15 complex samples (cq15_t) in place
+ *@note   One packed word per pair, both lanes at once - the 14-bit values are re-centred by flipping
+ *        their top bit and scaled to Q15 by a two bit shift, the low lane never carries into the high lane
+ */
+
+void adc_capture_to_q15(adc_sample_t *buf, uint32_t n){
+
+    uint32_t i;
+    uint32_t w;
+
+    for (i = 0U; i < n; i++) {
+        memcpy(&w, &buf[i], sizeof(w));
+        w = ((w & 0x3FFF3FFFU) ^ 0x20002000U) << 2;
+        memcpy(&buf[i], &w, sizeof(w));
+    }
+}
+
+/*
+ *@brief  Fills buf with n offset binary sample pairs of a test beat tone, advancing by 3 twiddles per chirp
+ *@note   Stands in for a captured chirp in the benchmarks, the tone is taken from the FFT twiddle table
+ */
+
+void adc_capture_fill_test_chirp(adc_sample_t *buf, uint32_t n, uint32_t chirp){
+
+    uint32_t i;
+    uint32_t w;
+
+    for (i = 0U; i < n; i++) {
+        w = fft_twiddle_q15[((7U * i) + (3U * chirp)) % (3U * FFT_MAX_POINTS / 4U)];
+        buf[i].a = (uint16_t)(((int16_t)(w & 0xFFFFU) >> 3) + 0x2000);
+        buf[i].b = (uint16_t)(((int16_t)(w >> 16) >> 3) + 0x2000);
+    }
+}
+
+/*
+ *@brief  Returns the capture statistics
+ */
+
+const adc_capture_stats_t *adc_capture_get_stats(void){
+
+    return &stats;
+}
+
+
+#if !ADC_CAPTURE_SIMULATOR
+/*===============================================================*/
+/*DCMI Back End                                                  */
+/*===============================================================*/
+
+static const stm32_dma_stream_t *capture_dma;
+static uint32_t capture_words;          // DMA transfers of both halves
+
+// DCMI pins, the pin plan of the file header
+static const struct {
+    ioportid_t port;
+    iopadid_t  pad;
+} capture_pins[] = {
+    { GPIOA, 6U  },     // PIXCLK
+    { GPIOB, 7U  },     // VSYNC
+    { GPIOA, 9U  },     // D0
+    { GPIOA, 10U },     // D1
+    { GPIOE, 0U  },     // D2
+    { GPIOE, 1U  },     // D3
+    { GPIOE, 4U  },     // D4
+    { GPIOB, 6U  },     // D5
+    { GPIOE, 5U  },     // D6
+    { GPIOE, 6U  },     // D7
+    { GPIOC, 10U },     // D8
+    { GPIOC, 12U },     // D9
+    { GPIOD, 6U  },     // D10
+    { GPIOD, 2U  },     // D11
+    { GPIOF, 11U },     // D12
+    { GPIOG, 15U }      // D13
+};
+
+
+/*
+ *@brief  DMA half/full transfer interrupt
+ */
+
+static void capture_dma_cb(void *p, uint32_t flags){
+
+    (void)p;
+
+    osalSysLockFromISR();
+
+    if ((DCMI->RISR & DCMI_RISR_OVF_RIS) != 0U) {
+        DCMI->ICR = DCMI_ICR_OVF_ISC;
+        stats.dcmi_overruns++;
+    }
+    if ((flags & (STM32_DMA_ISR_TEIF | STM32_DMA_ISR_DMEIF)) != 0U) {
+        stats.dma_errors++;
+    }
+
+    // Both flags are set when the interrupt was held off for a whole half
+    if ((flags & STM32_DMA_ISR_HTIF) != 0U) {
+        adc_capture_half_doneI(0U);
+    }
+    if ((flags & STM32_DMA_ISR_TCIF) != 0U) {
+        adc_capture_half_doneI(1U);
+    }
+
+    osalSysUnlockFromISR();
+}
+
+/*
+ *@brief  ADF4159 ramp complete edge, called from the EXTI ISR
+ */
+
+static void capture_ramp_cb(rtcnt_t stamp){
+
+    osalSysLockFromISR();
+    adc_capture_ramp_edgeI(stamp);
+    osalSysUnlockFromISR();
+}
+
+/*
+ *@brief  Starts the DMA over both buffer halves, then the DCMI continuous capture
+ *@note   In ramp trigger mode the capture is left to the first ramp complete edge
+ */
+
+void adc_capture_lld_start(adc_sample_t *buf, const adc_capture_config_t *cfg){
+
+    bool busy;
+    uint32_t i;
+
+    for (i = 0U; i < (sizeof(capture_pins) / sizeof(capture_pins[0])); i++) {
+        palSetPadMode(capture_pins[i].port, capture_pins[i].pad, PAL_MODE_ALTERNATE(13) | PAL_STM32_OSPEED_HIGHEST);
+    }
+
+    rccEnableAHB2(RCC_AHB2ENR_DCMIEN, FALSE);
+
+    capture_dma = STM32_DMA_STREAM(ADC_CAPTURE_DMA_STREAM);
+    busy = dmaStreamAllocate(capture_dma, ADC_CAPTURE_DMA_IRQ_PRIORITY, capture_dma_cb, NULL);
+    osalDbgAssert(!busy, "stream already allocated");
+    (void)busy;
+
+    DCMI->CR  = ADC_CAPTURE_DCMI_CR;
+    DCMI->ICR = DCMI_ICR_OVF_ISC;
+
+    // One sample pair per 32-bit transfer, two chirps per circular pass
+    dmaStreamSetPeripheral(capture_dma, &DCMI->DR);
+    dmaStreamSetMemory0(capture_dma, buf);
+    capture_words = 2U * cfg->samples;
+    dmaStreamSetTransactionSize(capture_dma, capture_words);
+    dmaStreamSetMode(capture_dma, STM32_DMA_CR_CHSEL(ADC_CAPTURE_DMA_CHANNEL) |
+                                  STM32_DMA_CR_PL(ADC_CAPTURE_DMA_PRIORITY) |
+                                  STM32_DMA_CR_DIR_P2M | STM32_DMA_CR_MINC |
+                                  STM32_DMA_CR_PSIZE_WORD | STM32_DMA_CR_MSIZE_WORD |
+                                  STM32_DMA_CR_CIRC | STM32_DMA_CR_HTIE | STM32_DMA_CR_TCIE |
+                                  STM32_DMA_CR_TEIE | STM32_DMA_CR_DMEIE);
+    dmaStreamEnable(capture_dma);
+
+    DCMI->CR |= DCMI_CR_ENABLE;
+    if (cfg->ramp_trigger) {
+        lock_detect_set_edge_hook(LOCK_ADF4159, capture_ramp_cb);
+    }
+    else {
+        DCMI->CR |= DCMI_CR_CAPTURE;
+    }
+}
+
+/*
+ *@brief  Starts the capture on the first ramp complete edge
+ *@note   I-class
+ */
+
+void adc_capture_lld_trigger(void){
+
+    DCMI->CR |= DCMI_CR_CAPTURE;
+}
+
+/*
+ *@brief  Returns the sample pair the DMA was writing at the ramp edge of stamp, 0 to 2 * samples - 1
+ *@note   The pairs converted from the edge to now, the time since the EXTI timestamp plus the nominal edge latency,
+ *        are taken off the position. The DMA trails the converter by the DCMI FIFO fill, half the FIFO is added back
+ */
+
+uint32_t adc_capture_lld_position(rtcnt_t stamp){
+
+    uint32_t pos = capture_words - dmaStreamGetTransactionSize(capture_dma);
+    uint64_t ns = (((uint64_t)(TIMING_PROBE_NOW() - stamp) * 1000000000ULL) / TIMING_PROBE_FREQ) + ADC_CAPTURE_EDGE_LATENCY_NS;
+    uint32_t late = ADC_CAPTURE_SAMPLES(ns, AD9648_ENCODE_HZ) % capture_words;
+
+    return (pos + capture_words + (ADC_CAPTURE_DCMI_FIFO_WORDS / 2U) - late) % capture_words;
+}
+
+/*
+ *@brief  Restarts the capture at the start of the first half, the DCMI FIFO is flushed
+ *@note   I-class, the partly filled half is dropped
+ */
+
+void adc_capture_lld_restart(void){
+
+    DCMI->CR &= ~(DCMI_CR_CAPTURE | DCMI_CR_ENABLE);
+
+    dmaStreamDisable(capture_dma);
+    dmaStreamSetTransactionSize(capture_dma, capture_words);
+    dmaStreamEnable(capture_dma);
+
+    DCMI->CR |= DCMI_CR_ENABLE;
+    DCMI->CR |= DCMI_CR_CAPTURE;
+}
+
+/*
+ *@brief  Stops the DCMI capture and the DMA
+ */
+
+void adc_capture_lld_stop(void){
+
+    lock_detect_set_edge_hook(LOCK_ADF4159, NULL);
+
+    DCMI->CR &= ~DCMI_CR_CAPTURE;
+    DCMI->CR &= ~DCMI_CR_ENABLE;
+
+    dmaStreamDisable(capture_dma);
+    dmaStreamRelease(capture_dma);
+
+    rccDisableAHB2(RCC_AHB2ENR_DCMIEN, FALSE);
+}
+#endif
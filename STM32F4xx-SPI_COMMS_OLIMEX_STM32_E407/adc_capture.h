@@ -0,0 +1,159 @@
+/// @file adc_capture.h
+/// @brief Variable/Function Declarations - AD9648 sample capture through DCMI and DMA2 ping-pong buffers
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+#include "hal.h"
+#include "global.h"
+
+/// Largest number of sample pairs per chirp, each buffer half holds one chirp
+#if !defined(ADC_CAPTURE_MAX_SAMPLES)
+#define ADC_CAPTURE_MAX_SAMPLES         1024U
+#endif
+
+/// DMA stream of the DCMI, DMA2 stream 1 or 7, channel 1
+#if !defined(ADC_CAPTURE_DMA_STREAM)
+#define ADC_CAPTURE_DMA_STREAM          STM32_DMA_STREAM_ID(2, 1)
+#endif
+
+#define ADC_CAPTURE_DMA_CHANNEL         1U
+
+/// DMA stream priority, above the SPI1 streams - the DCMI FIFO holds only 8 words
+#if !defined(ADC_CAPTURE_DMA_PRIORITY)
+#define ADC_CAPTURE_DMA_PRIORITY        3U
+#endif
+
+/// DMA interrupt priority of the half/full transfer callbacks
+#if !defined(ADC_CAPTURE_DMA_IRQ_PRIORITY)
+#define ADC_CAPTURE_DMA_IRQ_PRIORITY    6U
+#endif
+
+/// DCMI synchronisation - 14-bit data, VSYNC frames each chirp (ramp gate), HSYNC unused and
+/// held inactive (PA4 is the SPI1 chip select), data latched on the PIXCLK rising edge
+#if !defined(ADC_CAPTURE_DCMI_CR)
+#define ADC_CAPTURE_DCMI_CR             (DCMI_CR_EDM_0 | DCMI_CR_EDM_1 | DCMI_CR_HSPOL | DCMI_CR_PCKPOL)
+#endif
+
+/// Ramp trigger mode - nominal MUXOUT edge to EXTI timestamp latency, interrupt entry and the EXT dispatch (nS)
+#if !defined(ADC_CAPTURE_EDGE_LATENCY_NS)
+#define ADC_CAPTURE_EDGE_LATENCY_NS     300U
+#endif
+
+/// Ramp trigger mode - spread of that latency (nS), the EXTI shares priority 6 with the capture DMA interrupt
+#if !defined(ADC_CAPTURE_EDGE_JITTER_NS)
+#define ADC_CAPTURE_EDGE_JITTER_NS      1000U
+#endif
+
+/// DCMI FIFO depth, the DMA position trails the converter by 0 to this many sample pairs
+#define ADC_CAPTURE_DCMI_FIFO_WORDS     8U
+
+/// Ramp trigger mode - largest slip of a ramp complete edge against a half boundary before the capture is realigned
+/// (sample pairs). The DMA position is corrected by the latency, what is left is the FIFO fill and the latency spread.
+/// adc_capture_stats_t.max_slip gives the measured figure to size it on the board
+#if !defined(ADC_CAPTURE_ALIGN_SLIP)
+#define ADC_CAPTURE_ALIGN_SLIP          (ADC_CAPTURE_DCMI_FIFO_WORDS +                                      \
+                                         ADC_CAPTURE_SAMPLES(ADC_CAPTURE_EDGE_JITTER_NS, AD9648_ENCODE_HZ) + 1U)
+#endif
+
+/// Simulator beat tone, in FFT bins of one chirp
+#if !defined(ADC_CAPTURE_SIM_BEAT_BIN)
+#define ADC_CAPTURE_SIM_BEAT_BIN        8U
+#endif
+
+/// Simulator beat tone amplitude (LSB of the 14-bit converter)
+#if !defined(ADC_CAPTURE_SIM_AMPLITUDE)
+#define ADC_CAPTURE_SIM_AMPLITUDE       4096
+#endif
+
+/// Simulator beat tone phase advance from one chirp to the next (2^32 = one cycle), a moving target
+#if !defined(ADC_CAPTURE_SIM_DOPPLER_STEP)
+#define ADC_CAPTURE_SIM_DOPPLER_STEP    0x04000000UL
+#endif
+
+/// Full scale and mid scale of the 14-bit converter outputs (offset binary)
+#define ADC_CAPTURE_FULL_SCALE          0x3FFFU
+#define ADC_CAPTURE_MID_SCALE           0x2000U
+
+/// Sample pairs of a chirp of duration_ns at the AD9648 encode clock
+#define ADC_CAPTURE_SAMPLES(duration_ns, encode_hz)                             \
+    ((uint32_t)(((uint64_t)(duration_ns) * (encode_hz)) / 1000000000ULL))
+
+/*
+ * One sample pair, channel A then channel B as packed into a DCMI data word by the
+ * interleaved (channel multiplexed) AD9648 output, 14 bits offset binary in the low bits
+ */
+typedef struct {
+    uint16_t a;             ///< Channel A (I)
+    uint16_t b;             ///< Channel B (Q)
+} adc_sample_t;
+
+/*
+ * One captured chirp
+ */
+typedef struct {
+    adc_sample_t       *buf;    ///< Sample pairs, one buffer half, may be processed in place until released
+    uint32_t            n;      ///< Number of sample pairs
+    uint32_t            chirp;  ///< Chirp number since the capture start
+    uint32_t            ramp;   ///< Ramp number since the first ramp complete edge in ramp trigger mode, else the chirp number -
+                                ///< a triangular ramp alternates between up and down sweeps from one ramp to the next
+    rtcnt_t             stamp;  ///< Chirp start - ramp complete edge in ramp trigger mode, else the DMA entering the half (TIMING_PROBE_FREQ)
+} adc_chirp_t;
+
+/*
+ * Chirp callback, called from ISR context with the kernel locked (I-class functions only)
+ * for each completed buffer half. The half belongs to the callee until released by
+ * adc_capture_release()/adc_capture_releaseI(), it must be released before the DMA
+ * finishes the other half or the capture overruns.
+ */
+typedef void (*adc_capture_cb_t)(const adc_chirp_t *chirp);
+
+/*
+ * Capture configuration
+ */
+typedef struct {
+    uint32_t          samples;      ///< Sample pairs per chirp, at most ADC_CAPTURE_MAX_SAMPLES
+    adc_capture_cb_t  cb;           ///< Chirp callback
+    uint32_t          period_us;    ///< Chirp repetition period, simulator only
+    bool              ramp_trigger; ///< Start and align the capture on the ADF4159 ramp complete edges, needs MUXOUT = ramp complete
+    bool              triangle;     ///< Triangular ramp, simulator only - up and down sweeps alternate from chirp to chirp
+} adc_capture_config_t;
+
+/*
+ * Capture statistics
+ */
+typedef struct {
+    uint32_t chirps;        ///< Buffer halves delivered
+    uint32_t samples;       ///< Sample pairs delivered
+    uint32_t overruns;      ///< Halves overwritten while still held by the consumer
+    uint32_t dcmi_overruns; ///< DCMI FIFO overruns, the DMA did not keep up
+    uint32_t dma_errors;    ///< DMA transfer or direct mode errors
+    uint32_t triggers;      ///< Ramp complete edges seen in ramp trigger mode
+    uint32_t realigns;      ///< Capture restarts after the DMA slipped against the ramp
+    uint32_t max_slip;      ///< Largest slip of a ramp edge against a half boundary (sample pairs), a lost ramp shows as a large slip
+    rtcnt_t  max_hold;      ///< Longest time a half was held by the consumer (TIMING_PROBE_FREQ)
+} adc_capture_stats_t;
+
+/*
+ * Function declarations
+ */
+void adc_capture_start(const adc_capture_config_t *cfg);
+void adc_capture_stop(void);
+void adc_capture_releaseI(const adc_sample_t *buf);
+void adc_capture_release(const adc_sample_t *buf);
+void adc_capture_to_q15(adc_sample_t *buf, uint32_t n);
+void adc_capture_fill_test_chirp(adc_sample_t *buf, uint32_t n, uint32_t chirp);
+const adc_capture_stats_t *adc_capture_get_stats(void);
+
+/*
+ * Capture back end, DCMI in adc_capture.c or the generator in adc_capture_sim.c
+ */
+void adc_capture_lld_start(adc_sample_t *buf, const adc_capture_config_t *cfg);
+void adc_capture_lld_stop(void);
+void adc_capture_lld_trigger(void);
+uint32_t adc_capture_lld_position(rtcnt_t stamp);
+void adc_capture_lld_restart(void);
+void adc_capture_half_doneI(uint8_t half);
+void adc_capture_ramp_edgeI(rtcnt_t stamp);
@@ -0,0 +1,192 @@
+/// @file adc_capture_sim.c
+/// @brief Synthetic stand-in for the DCMI capture back end
+///
+/// Built instead of the DCMI back end when ADC_CAPTURE_SIMULATOR is TRUE, e.g. on the
+/// ChibiOS simulator port. A virtual timer fires once per chirp period, fills the next
+/// buffer half with a beat tone (channel A cosine, channel B sine, offset binary) plus
+/// a few LSB of noise and hands it over through adc_capture_half_doneI(), so consumers,
+/// callback timing and overrun accounting are exercised without a board.
+///
+/// The beat tone sits on FFT bin ADC_CAPTURE_SIM_BEAT_BIN of a chirp and its start
+/// phase advances by ADC_CAPTURE_SIM_DOPPLER_STEP from chirp to chirp.
+///
+/// With a triangular ramp the chirps alternate between down and up sweeps, down first as
+/// after the first ramp complete edge of the ADF4159. The Doppler shift of the target,
+/// ADC_CAPTURE_SIM_DOPPLER_STEP cycles per chirp, is taken off the beat frequency of the
+/// up sweeps and added to that of the down sweeps, and the down sweep tones are mirrored
+/// to negative frequencies, as the quadrature mixer sees them.
+///
+/// In ramp trigger mode the timer also stands in for the ramp complete edges: the
+/// first one starts the generator, the following ones mark each chirp start.
+///
+/// @author Peter Ludlow
+
+#include "ch.h"
+#include "hal.h"
+#include "adc_capture.h"
+#include "timing_probe.h"
+
+#if ADC_CAPTURE_SIMULATOR
+
+static virtual_timer_t sim_vt;
+
+static struct {
+    adc_sample_t *buf;          // Both buffer halves
+    uint32_t      samples;      // Sample pairs per half
+    systime_t     period;       // Chirp period in system ticks
+    uint32_t      step;         // Beat tone phase step per sample
+    uint32_t      shift;        // Doppler shift phase step per sample
+    uint32_t      start;        // Beat tone phase at the start of the next chirp
+    uint32_t      noise;        // Noise generator state
+    uint8_t       half;         // Next half to fill
+    bool          ramp;         // Ramp trigger mode
+    bool          triangle;     // Alternate down and up sweeps
+    bool          down;         // Next chirp is a down sweep
+    bool          running;      // Generating, after the first ramp edge in ramp trigger mode
+} sim;
+
+
+/*
+ *@brief  Sine of a 32-bit phase (2^32 = one cycle), Q15, parabolic approximation
+ */
+
+static int32_t sim_sin(uint32_t phase){
+
+    int32_t x = (int16_t)(phase >> 16);
+    int32_t s = (x * (32768 - ((x < 0) ? -x : x))) >> 13;
+
+    return (s > 32767) ? 32767 : s;
+}
+
+/*
+ *@brief  Converter word of a Q15 signal value plus noise
+ */
+
+static uint16_t sim_word(int32_t q15){
+
+    int32_t v;
+
+    // xorshift32, +-4 LSB
+    sim.noise ^= sim.noise << 13;
+    sim.noise ^= sim.noise >> 17;
+    sim.noise ^= sim.noise << 5;
+
+    v = (int32_t)ADC_CAPTURE_MID_SCALE + ((q15 * ADC_CAPTURE_SIM_AMPLITUDE) >> 15) + (int32_t)(sim.noise & 7U) - 4;
+    if (v < 0) {
+        v = 0;
+    }
+    if (v > (int32_t)ADC_CAPTURE_FULL_SCALE) {
+        v = (int32_t)ADC_CAPTURE_FULL_SCALE;
+    }
+
+    return (uint16_t)v;
+}
+
+/*
+ *@brief  Chirp period timer, fills and delivers one buffer half
+ */
+
+static void sim_chirp_cb(void *p){
+
+    adc_sample_t *s;
+    uint32_t phase;
+    uint32_t step;
+    uint32_t i;
+
+    (void)p;
+
+    chSysLockFromISR();
+
+    if (sim.running) {
+        s = &sim.buf[sim.half * sim.samples];
+        phase = sim.start;
+        step = sim.step;
+        if (sim.triangle) {
+            step = sim.down ? (0U - (sim.step + sim.shift)) : (sim.step - sim.shift);
+            sim.down = !sim.down;
+        }
+        for (i = 0U; i < sim.samples; i++) {
+            s[i].a = sim_word(sim_sin(phase + 0x40000000UL));
+            s[i].b = sim_word(sim_sin(phase));
+            phase += step;
+        }
+        sim.start += ADC_CAPTURE_SIM_DOPPLER_STEP;
+
+        adc_capture_half_doneI(sim.half);
+        sim.half ^= 1U;
+    }
+
+    if (sim.ramp) {
+        adc_capture_ramp_edgeI(TIMING_PROBE_NOW());
+    }
+
+    chVTSetI(&sim_vt, sim.period, sim_chirp_cb, NULL);
+    chSysUnlockFromISR();
+}
+
+/*
+ *@brief  Starts the chirp period timer
+ */
+
+void adc_capture_lld_start(adc_sample_t *buf, const adc_capture_config_t *cfg){
+
+    sim.buf      = buf;
+    sim.samples  = cfg->samples;
+    sim.period   = US2ST(cfg->period_us);
+    sim.step     = (uint32_t)(((uint64_t)ADC_CAPTURE_SIM_BEAT_BIN << 32) / cfg->samples);
+    sim.shift    = ADC_CAPTURE_SIM_DOPPLER_STEP / cfg->samples;
+    sim.start    = 0U;
+    sim.noise    = 0x2545F491UL;
+    sim.half     = 0U;
+    sim.ramp     = cfg->ramp_trigger;
+    sim.triangle = cfg->triangle;
+    sim.down     = true;
+    sim.running  = !cfg->ramp_trigger;
+
+    if (sim.period == 0U) {
+        sim.period = 1U;
+    }
+
+    chVTObjectInit(&sim_vt);
+    chVTSet(&sim_vt, sim.period, sim_chirp_cb, NULL);
+}
+
+/*
+ *@brief  Stops the chirp period timer
+ */
+
+void adc_capture_lld_stop(void){
+
+    chVTReset(&sim_vt);
+}
+
+/*
+ *@brief  First ramp edge, starts the generator
+ */
+
+void adc_capture_lld_trigger(void){
+
+    sim.running = true;
+}
+
+/*
+ *@brief  Returns the sample pair generated next, always on a half boundary, the edges have no latency
+ */
+
+uint32_t adc_capture_lld_position(rtcnt_t stamp){
+
+    (void)stamp;
+
+    return (uint32_t)sim.half * sim.samples;
+}
+
+/*
+ *@brief  Restarts the generator at the start of the first half
+ */
+
+void adc_capture_lld_restart(void){
+
+    sim.half = 0U;
+}
+
+#endif
@@ -0,0 +1,174 @@
+/// @file adf4159_chirp.c
+/// @brief ADF4159 FMCW chirp parameter compiler
+///
+/// Turns a chirp description (start frequency, bandwidth, ramp duration, shape and
+/// MUXOUT mode) into the R0-R7 words of the ADF4159, including the CLK DIV SEL,
+/// DEV SEL and STEP SEL = 1 double loads, using integer arithmetic only. Fields not
+/// related to the chirp (charge pump current, prescaler, R3 options) keep the values
+/// of the power-on tables.
+///
+///   fPFD      = REFin / R
+///   fRF       = fPFD x (INT + FRAC / 2^25), fOUT = ADF4159_OUT_MULT x fRF
+///   tSTEP     = CLK1 x CLK2 / fPFD
+///   fDEV      = fPFD / 2^25 x DEV x 2^DEV_OFFSET
+///   bandwidth = STEPS x fDEV
+///
+/// The module only depends on the C library, so it can be built on the host, where
+/// adf4159_chirp_ref.c checks it against the words of the power-on tables.
+///
+/// @author Peter Ludlow
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "adf4159_chirp.h"
+
+#define NS_PER_S                1000000000ULL
+
+/*
+ * Register templates, fields not set by the compiler as in the power-on tables
+ */
+#define R1_BASE                 0x00000001UL    // LSB FRAC = 0
+#define R2_BASE                 0x00400002UL    // Prescaler 8/9, CP current = min, CLK1 and R counter cleared
+#define R3_BASE                 0x00630083UL    // Ramp mode cleared
+#define R4_BASE                 0x00180004UL    // Ramp divider clock mode, CLK2 and ramp status cleared
+#define R5_BASE                 0x00000005UL
+#define R6_BASE                 0x00000006UL
+#define R7_BASE                 0x00000007UL
+
+#define R0_RAMP_ON              (1UL << 31)
+#define R4_CLK_DIV_SEL          (1UL << 6)
+#define R4_RAMP_COMPLETE        (3UL << 21)     // Ramp status = ramp complete to MUXOUT
+#define R5_DEV_SEL              (1UL << 23)
+#define R6_STEP_SEL             (1UL << 23)
+#define R3_MODE_SAWTOOTH        (0UL << 10)
+#define R3_MODE_TRIANGLE        (1UL << 10)
+
+
+/*
+ *@brief  Rounded unsigned 64-bit division
+ */
+
+static uint64_t div_round(uint64_t num, uint64_t den){
+
+    return (num + (den / 2U)) / den;
+}
+
+/*
+ *@brief  Compiles a chirp description into ADF4159 register words
+ *@note   r_div is the 5-bit R counter (1 to 32). Returns false, leaving plan undefined, when the chirp cannot be
+ *        synthesized: PFD above 110 MHz, RF outside 0.5-13 GHz, INT out of range, CLK1/CLK2/step count or
+ *        deviation out of range
+ */
+
+bool adf4159_chirp_compile(const adf4159_chirp_t *chirp, uint32_t ref_hz, uint8_t r_div, adf4159_chirp_plan_t *plan){
+
+    uint64_t fout_pfd, rem, frac, n_int, end_int, clk, steps, num, den, dev = 0;
+    uint32_t fpfd, step_ns, clk2 = 1U;
+    uint8_t off = 0;
+    uint32_t r3_mode;
+
+    if ((r_div == 0U) || (r_div > 32U) || (ref_hz == 0U)) {
+        return false;
+    }
+    fpfd = ref_hz / r_div;
+    if ((fpfd == 0U) || (fpfd > ADF4159_PFD_MAX_HZ)) {
+        return false;
+    }
+
+    /*
+     * Start frequency - INT and 25-bit FRAC, computed at the output so the multiplier adds no rounding
+     */
+
+    fout_pfd = (uint64_t)fpfd * ADF4159_OUT_MULT;
+    if ((chirp->start_hz < (ADF4159_RF_MIN_HZ * ADF4159_OUT_MULT)) ||
+        ((chirp->start_hz + chirp->bandwidth_hz) > (ADF4159_RF_MAX_HZ * ADF4159_OUT_MULT))) {
+        return false;
+    }
+
+    n_int = chirp->start_hz / fout_pfd;
+    rem   = chirp->start_hz % fout_pfd;
+    frac  = div_round(rem << ADF4159_FRAC_BITS, fout_pfd);
+    if (frac >= (1UL << ADF4159_FRAC_BITS)) {
+        frac = 0U;
+        n_int++;
+    }
+    end_int = (chirp->start_hz + chirp->bandwidth_hz) / fout_pfd;
+    if ((n_int < ADF4159_INT_MIN) || (end_int > ADF4159_INT_MAX)) {
+        return false;
+    }
+
+    /*
+     * Ramp timer - CLK1 x CLK2 fPFD cycles per step, CLK2 only used once CLK1 overflows
+     */
+
+    step_ns = (chirp->step_ns != 0U) ? chirp->step_ns : ADF4159_CHIRP_STEP_NS;
+    clk = div_round((uint64_t)step_ns * fpfd, NS_PER_S);
+    if (clk > ADF4159_CLK_MAX) {
+        clk2 = (uint32_t)((clk + ADF4159_CLK_MAX - 1U) / ADF4159_CLK_MAX);
+        clk  = div_round(clk, clk2);
+    }
+    if ((clk < 2U) || (clk > ADF4159_CLK_MAX) || (clk2 > ADF4159_CLK_MAX)) {
+        return false;
+    }
+
+    steps = div_round((uint64_t)chirp->duration_ns * fpfd, NS_PER_S * clk * clk2);
+    if (chirp->shape == ADF4159_RAMP_OFF) {
+        steps = (steps == 0U) ? 1U : steps;
+    }
+    else if ((steps == 0U) || (steps > ADF4159_STEPS_MAX)) {
+        return false;
+    }
+
+    /*
+     * Deviation per step, smallest offset keeping DEV within 16 bits for the best resolution
+     */
+
+    if (chirp->shape != ADF4159_RAMP_OFF) {
+        num = (uint64_t)chirp->bandwidth_hz << ADF4159_FRAC_BITS;
+        den = fout_pfd * steps;
+        dev = div_round(num, den);
+        while ((dev > (uint64_t)ADF4159_DEV_MAX) && (off < ADF4159_DEV_OFFSET_MAX)) {
+            off++;
+            dev = div_round(num, den << off);
+        }
+        if ((dev == 0U) || (dev > (uint64_t)ADF4159_DEV_MAX)) {
+            return false;
+        }
+    }
+
+    plan->int_val      = (uint16_t)n_int;
+    plan->frac         = (uint32_t)frac;
+    plan->clk1         = (uint16_t)clk;
+    plan->clk2         = (uint16_t)clk2;
+    plan->steps        = (uint32_t)steps;
+    plan->dev          = (int16_t)dev;
+    plan->dev_offset   = off;
+    plan->bandwidth_hz = ((dev << off) * fout_pfd * steps) >> ADF4159_FRAC_BITS;
+    plan->duration_ns  = (uint32_t)div_round(steps * clk * clk2 * NS_PER_S, fpfd);
+
+    /*
+     * Register words
+     */
+
+    r3_mode = (chirp->shape == ADF4159_RAMP_TRIANGLE) ? R3_MODE_TRIANGLE : R3_MODE_SAWTOOTH;
+
+    plan->reg[0] = ((chirp->shape != ADF4159_RAMP_OFF) ? R0_RAMP_ON : 0U) |
+                   (((uint32_t)chirp->muxout & 0xFU) << 27) |
+                   ((uint32_t)plan->int_val << 15) |
+                   ((plan->frac >> 13) << 3);
+    plan->reg[1] = R1_BASE | ((plan->frac & 0x1FFFU) << 15);
+    plan->reg[2] = R2_BASE | (((uint32_t)r_div & 0x1FU) << 15) | ((uint32_t)plan->clk1 << 3);
+    plan->reg[3] = R3_BASE | r3_mode;
+    plan->reg[4] = R4_BASE | ((uint32_t)plan->clk2 << 7) |
+                   ((chirp->muxout == ADF4159_MUXOUT_RAMP_COMPLETE) ? R4_RAMP_COMPLETE : 0U);
+    plan->reg[5] = R5_BASE | ((uint32_t)off << 19) | (((uint32_t)dev & 0xFFFFU) << 3);
+    plan->reg[6] = R6_BASE | (plan->steps << 3);
+    plan->reg[7] = R7_BASE;
+
+    // Second timer, deviation and step registers - single ramp, loaded with the same values
+    plan->reg[8]  = plan->reg[4] | R4_CLK_DIV_SEL;
+    plan->reg[9]  = plan->reg[5] | R5_DEV_SEL;
+    plan->reg[10] = plan->reg[6] | R6_STEP_SEL;
+
+    return true;
+}
@@ -0,0 +1,96 @@
+/// @file adf4159_chirp.h
+/// @brief Variable/Function Declarations - ADF4159 FMCW chirp parameter compiler
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/// Output frequency multiplier after the synthesizer, the front end doubles the ADF4159 RF output
+#if !defined(ADF4159_OUT_MULT)
+#define ADF4159_OUT_MULT        2U
+#endif
+
+/// Reference frequency and R counter of the power-on tables, fPFD = 100 MHz
+#if !defined(ADF4159_REF_HZ)
+#define ADF4159_REF_HZ          100000000UL
+#endif
+#if !defined(ADF4159_R_DIV)
+#define ADF4159_R_DIV           1U
+#endif
+
+/// Default duration of one ramp step (CLK1 x CLK2 / fPFD)
+#if !defined(ADF4159_CHIRP_STEP_NS)
+#define ADF4159_CHIRP_STEP_NS   500U
+#endif
+
+/*
+ * ADF4159 limits
+ */
+#define ADF4159_PFD_MAX_HZ      110000000UL     ///< Maximum PFD frequency
+#define ADF4159_RF_MIN_HZ       500000000ULL    ///< Minimum RF input frequency
+#define ADF4159_RF_MAX_HZ       13000000000ULL  ///< Maximum RF input frequency
+#define ADF4159_INT_MIN         75U             ///< Minimum INT with the 8/9 prescaler
+#define ADF4159_INT_MAX         4095U           ///< Maximum INT, 12 bits
+#define ADF4159_FRAC_BITS       25U             ///< Fractional modulus 2^25, 12 MSB in R0 and 13 LSB in R1
+#define ADF4159_CLK_MAX         4095U           ///< Maximum CLK1/CLK2 divider, 12 bits
+#define ADF4159_STEPS_MAX       1048575UL       ///< Maximum number of ramp steps, 20 bits
+#define ADF4159_DEV_MAX         32767           ///< Maximum deviation word, 16 bit two's complement
+#define ADF4159_DEV_OFFSET_MAX  9U              ///< Maximum deviation offset
+
+/// Number of compiled register words, R0..R7 followed by R4/R5/R6 with CLK DIV SEL/DEV SEL/STEP SEL = 1
+#define ADF4159_CHIRP_REGS      11U
+
+/*
+ * Ramp shape
+ */
+typedef enum {
+    ADF4159_RAMP_OFF = 0,       ///< Ramp disabled, fixed output at the start frequency
+    ADF4159_RAMP_SAWTOOTH,      ///< Continuous sawtooth ramp
+    ADF4159_RAMP_TRIANGLE       ///< Continuous triangular ramp, duration applies to each slope
+} adf4159_ramp_t;
+
+/*
+ * MUXOUT mode, R0 DB30:DB27
+ */
+typedef enum {
+    ADF4159_MUXOUT_DVDD          = 1,   ///< MUXOUT = DVDD
+    ADF4159_MUXOUT_R_DIVIDER     = 3,   ///< MUXOUT = R divider output
+    ADF4159_MUXOUT_LOCK_DETECT   = 6,   ///< MUXOUT = Digital lock detect
+    ADF4159_MUXOUT_RAMP_COMPLETE = 15   ///< MUXOUT = Ramp status, R4 ramp status = ramp complete
+} adf4159_muxout_t;
+
+/*
+ * Chirp description, frequencies at the multiplied output
+ */
+typedef struct {
+    uint64_t         start_hz;      ///< Ramp start frequency
+    uint32_t         bandwidth_hz;  ///< Ramp bandwidth, 0 with ADF4159_RAMP_OFF
+    uint32_t         duration_ns;   ///< Ramp duration
+    uint32_t         step_ns;       ///< Ramp step duration, 0 for ADF4159_CHIRP_STEP_NS
+    adf4159_ramp_t   shape;         ///< Ramp shape
+    adf4159_muxout_t muxout;        ///< MUXOUT mode
+} adf4159_chirp_t;
+
+/*
+ * Compiled chirp - register words and the values actually achieved
+ */
+typedef struct {
+    uint32_t reg[ADF4159_CHIRP_REGS];   ///< Register words, indexed as the ADF4159 register cache
+    uint16_t int_val;                   ///< INT
+    uint32_t frac;                      ///< 25-bit FRAC
+    uint16_t clk1;                      ///< CLK1 divider
+    uint16_t clk2;                      ///< CLK2 divider
+    uint32_t steps;                     ///< Number of ramp steps
+    int16_t  dev;                       ///< Deviation word
+    uint8_t  dev_offset;                ///< Deviation offset
+    uint64_t bandwidth_hz;              ///< Achieved ramp bandwidth at the output
+    uint32_t duration_ns;               ///< Achieved ramp duration
+} adf4159_chirp_plan_t;
+
+/*
+ * Function declarations
+ */
+bool adf4159_chirp_compile(const adf4159_chirp_t *chirp, uint32_t ref_hz, uint8_t r_div, adf4159_chirp_plan_t *plan);
@@ -0,0 +1,110 @@
+/// @file adf4159_chirp_ref.c
+/// @brief Host reference build of the ADF4159 chirp compiler, not part of the firmware
+///
+/// Runs the same adf4159_chirp.c on a PC, compiles the chirp of the power-on tables in
+/// init_functions.c, a 21.75 GHz start, 1 GHz, 1 mS per slope triangle with MUXOUT on
+/// digital lock detect, and compares every R0-R7 word, the SEL = 1 double loads included,
+/// with ADF4159_power_on_register_values_buf:
+///
+///   gcc -O2 -o adf4159_chirp_ref adf4159_chirp_ref.c adf4159_chirp.c
+///   adf4159_chirp_ref
+///
+/// The R5 words of the table hold DEV = 20974. The exact deviation of a 1 GHz ramp in
+/// 2000 steps is 500 MHz / 2000 x 2^25 / 100 MHz / 2^2 = 20971.52, which the compiler
+/// rounds to 20972. That difference, and only it, is allowed explicitly: R5 must match
+/// the table in every other field. One line per word and PASS or FAIL are printed, the
+/// result is the exit status.
+///
+/// @author Peter Ludlow
+
+#include <stdio.h>
+#include "adf4159_chirp.h"
+
+/// R5 DEV field, DB18:DB3
+#define CHIRP_REF_DEV_MASK      (0xFFFFUL << 3)
+
+/// DEV of the R5 words of the table and of the compiled chirp
+#define CHIRP_REF_TABLE_DEV     20974U
+#define CHIRP_REF_EXACT_DEV     20972U
+
+/*
+ * Power-on table words, indexed as the ADF4159 register cache: R0..R7, then R4/R5/R6 with SEL = 1
+ */
+static const uint32_t table[ADF4159_CHIRP_REGS] = {
+    0xB0366000UL,   // R0, ramp enabled, MUXOUT = digital lock detect
+    0x00000001UL,   // R1
+    0x00408192UL,   // R2
+    0x00630483UL,   // R3, continuous triangular ramp
+    0x00180084UL,   // R4, CLK DIV SEL = 0
+    0x00128F75UL,   // R5, DEV SEL = 0
+    0x00003E86UL,   // R6, STEP SEL = 0
+    0x00000007UL,   // R7
+    0x001800C4UL,   // R4, CLK DIV SEL = 1
+    0x00928F75UL,   // R5, DEV SEL = 1
+    0x00803E86UL,   // R6, STEP SEL = 1
+};
+
+static const char *const reg_name[ADF4159_CHIRP_REGS] = {
+    "R0", "R1", "R2", "R3", "R4", "R5", "R6", "R7", "R4 SEL1", "R5 SEL1", "R6 SEL1"
+};
+
+
+/*
+ *@brief  Returns true for the known R5 difference, DEV 20972 against 20974 with every other field equal
+ */
+
+static bool is_known(uint32_t i, uint32_t word){
+
+    if ((i != 5U) && (i != 9U)) {
+        return false;
+    }
+
+    return ((word & ~CHIRP_REF_DEV_MASK) == (table[i] & ~CHIRP_REF_DEV_MASK)) &&
+           (((word & CHIRP_REF_DEV_MASK) >> 3) == CHIRP_REF_EXACT_DEV) &&
+           (((table[i] & CHIRP_REF_DEV_MASK) >> 3) == CHIRP_REF_TABLE_DEV);
+}
+
+int main(void){
+
+    static const adf4159_chirp_t chirp = {
+        .start_hz     = 21750000000ULL,
+        .bandwidth_hz = 1000000000U,
+        .duration_ns  = 1000000U,
+        .step_ns      = 0U,
+        .shape        = ADF4159_RAMP_TRIANGLE,
+        .muxout       = ADF4159_MUXOUT_LOCK_DETECT,
+    };
+    adf4159_chirp_plan_t plan;
+    const char *verdict;
+    uint32_t i;
+    bool ok = true;
+
+    if (!adf4159_chirp_compile(&chirp, ADF4159_REF_HZ, ADF4159_R_DIV, &plan)) {
+        printf("chirp rejected\nFAIL\n");
+        return 1;
+    }
+
+    for (i = 0U; i < ADF4159_CHIRP_REGS; i++) {
+        if (plan.reg[i] == table[i]) {
+            verdict = "ok";
+        }
+        else if (is_known(i, plan.reg[i])) {
+            verdict = "known table difference, DEV 20972 against 20974";
+        }
+        else {
+            verdict = "MISMATCH";
+            ok = false;
+        }
+
+        printf("%-8s compiled 0x%08X  table 0x%08X  %s\n", reg_name[i], (unsigned)plan.reg[i],
+               (unsigned)table[i], verdict);
+    }
+
+    printf("INT %u FRAC %u CLK1 %u CLK2 %u steps %u DEV %d offset %u, %llu Hz in %u nS\n",
+           (unsigned)plan.int_val, (unsigned)plan.frac, (unsigned)plan.clk1, (unsigned)plan.clk2,
+           (unsigned)plan.steps, (int)plan.dev, (unsigned)plan.dev_offset,
+           (unsigned long long)plan.bandwidth_hz, (unsigned)plan.duration_ns);
+    printf("%s\n", ok ? "PASS" : "FAIL");
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,127 @@
+/// @file adf4159_hop.c
+/// @brief ADF4159 start frequency hopping from a flash channel table
+///
+/// The INT/FRAC fields of every channel are computed by the compiler from the channel
+/// grid and stored as a const table in flash, so a hop performs no arithmetic: the R1
+/// and R0 fields of the channel are merged into the shadow registers and only the
+/// words that changed are sent through the DMA sequence engine (R1 only when its LSB
+/// FRAC differs, R0 always, as it latches R1 and holds INT/FRAC MSB).
+///
+/// The hop to lock time is only available while MUXOUT is digital lock detect. In ramp
+/// trigger mode MUXOUT carries ramp complete and its edges go to the capture hook, so
+/// a hop then arms no lock detection and adf4159_hop_wait() returns false at once.
+///
+/// @author Peter Ludlow
+
+#include "ch.h"
+#include "hal.h"
+#include "adf4159_hop.h"
+#include "reg_cache.h"
+#include "lock_detect.h"
+#include "timing_probe.h"
+
+#define HOP_ENTRY(ch)   { ADF4159_HOP_R0(ADF4159_HOP_FREQ(ch)), ADF4159_HOP_R1(ADF4159_HOP_FREQ(ch)) }
+
+static const adf4159_hop_entry_t hop_table[] = {
+        HOP_ENTRY(0),  HOP_ENTRY(1),  HOP_ENTRY(2),  HOP_ENTRY(3),
+        HOP_ENTRY(4),  HOP_ENTRY(5),  HOP_ENTRY(6),  HOP_ENTRY(7),
+        HOP_ENTRY(8),  HOP_ENTRY(9),  HOP_ENTRY(10), HOP_ENTRY(11),
+        HOP_ENTRY(12), HOP_ENTRY(13), HOP_ENTRY(14)
+};
+
+// The table must hold exactly one entry per channel of the grid
+typedef char hop_table_size_check[(sizeof(hop_table) / sizeof(hop_table[0]) == ADF4159_HOP_CHANNELS) ? 1 : -1];
+
+static uint8_t current = 0xFFU;
+static bool lock_armed = false;
+static time_measurement_t hop_time;
+static bool hop_time_init = false;
+
+
+/*
+ *@brief  Hops the ramp start frequency to a channel of the table
+ *@note   The ADF4159 must have been programmed (ADF4159_init() or ADF4159_set_chirp()). The time from call
+ *        to the end of the bus transfer is accumulated in the hop measurement. When MUXOUT is lock detect and
+ *        no edge hook holds the line, the lock detector is armed so adf4159_hop_wait() completes the hop and
+ *        records the call to lock time. Returns false for a channel outside the table
+ */
+
+bool adf4159_hop(uint8_t channel){
+
+    const adf4159_hop_entry_t *e;
+
+    if (channel >= ADF4159_HOP_CHANNELS) {
+        return false;
+    }
+    // R7 holds its address bits once the shadow image has been loaded
+    osalDbgAssert(reg_cache_get(&ADF4159_regs, ADF4159_REG(7)) != 0U, "ADF4159 not programmed");
+
+    if (!hop_time_init) {
+        chTMObjectInit(&hop_time);
+        hop_time_init = true;
+    }
+
+    chTMStartMeasurementX(&hop_time);
+    PROBE_BEGIN("adf4159_hop");
+    lock_armed = !lock_detect_hooked(LOCK_ADF4159) &&
+                 (ADF4159_HOP_R0_MUXOUT(reg_cache_get(&ADF4159_regs, ADF4159_REG(0))) == ADF4159_MUXOUT_LOCK_DETECT);
+    if (lock_armed) {
+        lock_detect_arm(LOCK_ADF4159);
+    }
+
+    e = &hop_table[channel];
+    reg_cache_set(&ADF4159_regs, ADF4159_REG(1), e->r1);
+    reg_cache_set_field(&ADF4159_regs, ADF4159_REG(0), ADF4159_HOP_R0_MASK, e->r0);
+    (void) reg_cache_flush(&ADF4159_regs);
+
+    chTMStopMeasurementX(&hop_time);
+    PROBE_END("adf4159_hop");
+
+    current = channel;
+
+    return true;
+}
+
+/*
+ *@brief  Waits for the ADF4159 to lock on the channel of the last hop
+ *@note   Returns false on timeout, and at once when that hop armed no lock detection (MUXOUT not lock detect
+ *        or a ramp trigger edge hook installed) - the hop to lock time is unavailable in ramp trigger mode
+ */
+
+bool adf4159_hop_wait(systime_t timeout){
+
+    bool locked = lock_armed && lock_detect_wait(LOCK_ADF4159, timeout);
+
+    if (locked) {
+        lock_armed = false;
+    }
+
+    return locked;
+}
+
+/*
+ *@brief  Returns the current channel, 0xFF before the first hop
+ */
+
+uint8_t adf4159_hop_channel(void){
+
+    return current;
+}
+
+/*
+ *@brief  Returns the table entry of a channel, NULL outside the table
+ */
+
+const adf4159_hop_entry_t *adf4159_hop_entry(uint8_t channel){
+
+    return (channel < ADF4159_HOP_CHANNELS) ? &hop_table[channel] : NULL;
+}
+
+/*
+ *@brief  Returns the call to bus completion time of the hops (CPU cycles)
+ */
+
+const time_measurement_t *adf4159_hop_get_time(void){
+
+    return &hop_time;
+}
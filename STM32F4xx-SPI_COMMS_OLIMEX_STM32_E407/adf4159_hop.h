@@ -0,0 +1,54 @@
+/// @file adf4159_hop.h
+/// @brief Variable/Function Declarations - ADF4159 start frequency hopping from a flash channel table
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+#include "hal.h"
+#include "adf4159_chirp.h"
+
+/*
+ * Channel grid - start frequencies of the FMCW ramp at the output, 21.70-22.40 GHz in 50 MHz steps,
+ * covering the start frequencies of the ADF4159 table variants (21.70, 21.75, 22.0, 22.05, 22.15, 22.25,
+ * 22.4 GHz), N = INT + FRAC / 4096 of their R0 words times 2 x 100 MHz
+ */
+#define ADF4159_HOP_FIRST_HZ    21700000000ULL
+#define ADF4159_HOP_SPACING_HZ  50000000ULL
+#define ADF4159_HOP_CHANNELS    15U
+
+/// Output frequency of a channel
+#define ADF4159_HOP_FREQ(ch)    (ADF4159_HOP_FIRST_HZ + ((uint64_t)(ch) * ADF4159_HOP_SPACING_HZ))
+
+/*
+ * Compile time register fields, N x 2^25 rounded at the output PFD frequency (fPFD x ADF4159_OUT_MULT)
+ */
+#define ADF4159_HOP_PFD_HZ      (((uint64_t)ADF4159_REF_HZ / ADF4159_R_DIV) * ADF4159_OUT_MULT)
+#define ADF4159_HOP_N25(f)      ((((uint64_t)(f) << ADF4159_FRAC_BITS) + (ADF4159_HOP_PFD_HZ / 2U)) / ADF4159_HOP_PFD_HZ)
+#define ADF4159_HOP_R0(f)       ((uint32_t)(((ADF4159_HOP_N25(f) >> 25) << 15) | \
+                                            (((ADF4159_HOP_N25(f) >> 13) & 0xFFFU) << 3)))
+#define ADF4159_HOP_R1(f)       ((uint32_t)(((ADF4159_HOP_N25(f) & 0x1FFFU) << 15) | 0x1U))
+
+/// MUXOUT mode field of an R0 word, DB30:DB27
+#define ADF4159_HOP_R0_MUXOUT(r0)   (((r0) >> 27) & 0xFU)
+
+/// R0 bits set by a hop, INT DB26:DB15 and FRAC MSB DB14:DB3 (ramp enable and MUXOUT are kept)
+#define ADF4159_HOP_R0_MASK     0x07FFFFF8UL
+
+/*
+ * Channel table entry, register fields of one start frequency
+ */
+typedef struct {
+    uint32_t r0;            ///< R0 INT and FRAC MSB fields
+    uint32_t r1;            ///< R1 word, LSB FRAC
+} adf4159_hop_entry_t;
+
+/*
+ * Function declarations
+ */
+bool adf4159_hop(uint8_t channel);
+bool adf4159_hop_wait(systime_t timeout);
+uint8_t adf4159_hop_channel(void);
+const adf4159_hop_entry_t *adf4159_hop_entry(uint8_t channel);
+const time_measurement_t *adf4159_hop_get_time(void);
@@ -0,0 +1,188 @@
+/// @file adf4355_freq.c
+/// @brief Integer ADF4355 frequency plan calculator
+///
+/// Computes INT, FRAC1, FRAC2, MOD2 and the RF output divider of a target output
+/// frequency with exact 64-bit integer arithmetic (the firmware is built without
+/// an FPU), together with the R0/R1/R2 words of the datasheet two-phase (fPFD / 2,
+/// then fPFD) programming sequence. A plan takes a handful of 64-bit divisions, meant
+/// to stay under the 20 uS budget of the retune path on the STM32F407 - the retunes
+/// record it as the "adf4355_plan" timing probe.
+///
+/// The module only depends on the C library, so it can be built on the host, where
+/// adf4355_ref.c checks it against the words of the power-on tables.
+///
+/// @author Peter Ludlow
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "adf4355_freq.h"
+
+
+/*
+ *@brief  Greatest common divisor
+ */
+
+static uint32_t gcd32(uint32_t a, uint32_t b){
+
+    uint32_t t;
+
+    while (b != 0U) {
+        t = a % b;
+        a = b;
+        b = t;
+    }
+
+    return a;
+}
+
+/*
+ *@brief  Frequency plan of an output frequency
+ *@note   mod2 = 0 selects the exact MOD2 = fPFD / GCD(fPFD, remainder), falling back to the largest MOD2 with
+ *        rounding when the exact value does not fit 14 bits. A non zero mod2 uses that modulus with rounding,
+ *        as the datasheet examples encoded in the power-on tables do. Returns false when out of range
+ */
+
+bool adf4355_plan(uint64_t rfout_hz, uint32_t fpfd_hz, uint16_t mod2, adf4355_plan_t *plan){
+
+    uint64_t fvco, n_int, rem, frac;
+    uint32_t rem2, frac2, g;
+    uint8_t div_sel = 0;
+
+    if ((fpfd_hz == 0U) || (fpfd_hz > ADF4355_PFD_MAX_HZ) || (mod2 > ADF4355_MOD2_MAX) || (rfout_hz == 0U)) {
+        return false;
+    }
+
+    // Smallest output divider bringing the VCO into its range
+    fvco = rfout_hz;
+    while ((fvco < ADF4355_VCO_MIN_HZ) && (div_sel < 6U)) {
+        fvco <<= 1;
+        div_sel++;
+    }
+    if ((fvco < ADF4355_VCO_MIN_HZ) || (fvco > ADF4355_VCO_MAX_HZ)) {
+        return false;
+    }
+
+    // N = fVCO / fPFD, remainder split over FRAC1 / MOD1 and FRAC2 / MOD2
+    n_int = fvco / fpfd_hz;
+    rem   = fvco % fpfd_hz;
+    frac  = (rem << 24) / fpfd_hz;
+    rem2  = (uint32_t)((rem << 24) % fpfd_hz);
+
+    if (mod2 == 0U) {
+        if (rem2 == 0U) {
+            mod2  = 2U;
+            frac2 = 0U;
+        }
+        else {
+            g = gcd32(fpfd_hz, rem2);
+            if ((fpfd_hz / g) <= ADF4355_MOD2_MAX) {
+                mod2  = (uint16_t)(fpfd_hz / g);
+                frac2 = rem2 / g;
+            }
+            else {
+                mod2  = ADF4355_MOD2_MAX;
+                frac2 = (uint32_t)((((uint64_t)rem2 * mod2) + (fpfd_hz / 2U)) / fpfd_hz);
+            }
+        }
+    }
+    else {
+        frac2 = (uint32_t)((((uint64_t)rem2 * mod2) + (fpfd_hz / 2U)) / fpfd_hz);
+    }
+
+    // Rounding may carry into FRAC1 and INT
+    if (frac2 >= mod2) {
+        frac2 -= mod2;
+        if (++frac >= ADF4355_MOD1) {
+            frac = 0U;
+            n_int++;
+        }
+    }
+
+    if ((n_int < ADF4355_INT_MIN) || (n_int > ADF4355_INT_MAX)) {
+        return false;
+    }
+
+    plan->int_val    = (uint16_t)n_int;
+    plan->frac1      = (uint32_t)frac;
+    plan->frac2      = (uint16_t)frac2;
+    plan->mod2       = mod2;
+    plan->rf_div_sel = div_sel;
+
+    // R0 - autocal DB21, prescaler 4/5 DB20 = 0, INT DB19:DB4
+    plan->r0 = ADF4355_R0_AUTOCAL | ((uint32_t)plan->int_val << 4) | 0x0U;
+    // R1 - FRAC1 DB27:DB4
+    plan->r1 = (plan->frac1 << 4) | 0x1U;
+    // R2 - FRAC2 DB31:DB18, MOD2 DB17:DB4
+    plan->r2 = ((uint32_t)plan->frac2 << 18) | ((uint32_t)plan->mod2 << 4) | 0x2U;
+
+    return true;
+}
+
+/*
+ *@brief  Frequency plans of the two-phase programming sequence, first pass at fPFD / 2, second pass at fPFD
+ */
+
+bool adf4355_plan_two_phase(uint64_t rfout_hz, uint32_t fpfd_hz, uint16_t mod2_half, uint16_t mod2_full,
+                            adf4355_two_phase_t *plan){
+
+    return adf4355_plan(rfout_hz, fpfd_hz / 2U, mod2_half, &plan->half) &&
+           adf4355_plan(rfout_hz, fpfd_hz, mod2_full, &plan->full);
+}
+
+/*
+ *@brief  R4 word with another R counter value
+ */
+
+uint32_t adf4355_r4_rcounter(uint32_t r4, uint16_t r){
+
+    return (r4 & ~ADF4355_R4_RCOUNTER_MASK) | (((uint32_t)r << ADF4355_R4_RCOUNTER_SHIFT) & ADF4355_R4_RCOUNTER_MASK);
+}
+
+/*
+ *@brief  R6 word with another RF output divider select
+ */
+
+uint32_t adf4355_r6_rfdiv(uint32_t r6, uint8_t rf_div_sel){
+
+    return (r6 & ~ADF4355_R6_RFDIV_MASK) | (((uint32_t)rf_div_sel << ADF4355_R6_RFDIV_SHIFT) & ADF4355_R6_RFDIV_MASK);
+}
+
+/*
+ *@brief  PFD frequency programmed by an R4 word, fPFD = REFin x (1 + D) / (R x (1 + T))
+ *@note   Returns 0 for an R counter of 0
+ */
+
+uint32_t adf4355_fpfd_hz(uint32_t ref_hz, uint32_t r4){
+
+    uint32_t r = (r4 & ADF4355_R4_RCOUNTER_MASK) >> ADF4355_R4_RCOUNTER_SHIFT;
+    uint64_t f = ref_hz;
+
+    if (r == 0U) {
+        return 0U;
+    }
+    if ((r4 & ADF4355_R4_DOUBLER) != 0U) {
+        f *= 2U;
+    }
+    if ((r4 & ADF4355_R4_RDIV2) != 0U) {
+        r *= 2U;
+    }
+
+    return (uint32_t)(f / r);
+}
+
+/*
+ *@brief  Wait of ADF4355_ADC_WAIT_CYCLES ADC_CLK cycles before autocalibration, ADC_CLK = fPFD / ((4 x R10 ADC clock divider) + 2)
+ *@note   Rounded up to the next nS. With a divider of 250 this is 320.6 uS at fPFD = 50 MHz, the > 320 uS of the
+ *        original fixed wait, and 160.3 uS at 100 MHz
+ */
+
+uint32_t adf4355_adc_wait_ns(uint32_t fpfd_hz, uint32_t r10){
+
+    uint64_t div = (r10 & ADF4355_R10_ADCDIV_MASK) >> ADF4355_R10_ADCDIV_SHIFT;
+
+    if (fpfd_hz == 0U) {
+        return 0U;
+    }
+
+    return (uint32_t)(((ADF4355_ADC_WAIT_CYCLES * ((4U * div) + 2U) * 1000000000ULL) + fpfd_hz - 1U) / fpfd_hz);
+}
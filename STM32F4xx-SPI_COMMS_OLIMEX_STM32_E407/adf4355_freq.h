@@ -0,0 +1,75 @@
+/// @file adf4355_freq.h
+/// @brief Variable/Function Declarations - Integer ADF4355 frequency plan calculator
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/// Reference frequency at REFin
+#if !defined(ADF4355_REF_HZ)
+#define ADF4355_REF_HZ          100000000UL
+#endif
+
+/// ADC_CLK cycles to wait between the R4 counter release and the R0 write starting the autocalibration
+#define ADF4355_ADC_WAIT_CYCLES 16U
+
+/*
+ * ADF4355 limits
+ */
+#define ADF4355_VCO_MIN_HZ      3400000000ULL   ///< Minimum VCO frequency
+#define ADF4355_VCO_MAX_HZ      6800000000ULL   ///< Maximum VCO frequency
+#define ADF4355_PFD_MAX_HZ      125000000UL     ///< Maximum PFD frequency
+#define ADF4355_MOD1            16777216UL      ///< Fixed primary modulus, 2^24
+#define ADF4355_MOD2_MAX        16383U          ///< Maximum auxiliary modulus, 14 bits
+#define ADF4355_INT_MIN         23U             ///< Minimum INT with the 4/5 prescaler
+#define ADF4355_INT_MAX         32767U          ///< Maximum INT with the 4/5 prescaler
+
+/*
+ * Register fields
+ */
+#define ADF4355_R0_AUTOCAL      (1UL << 21)     ///< R0 DB21 - VCO autocalibration on R0 write
+#define ADF4355_R4_COUNTER_RESET (1UL << 4)     ///< R4 DB4 - counter reset
+#define ADF4355_R4_RCOUNTER_SHIFT 15            ///< R4 DB24:DB15 - 10 bit R counter
+#define ADF4355_R4_RCOUNTER_MASK (0x3FFUL << ADF4355_R4_RCOUNTER_SHIFT)
+#define ADF4355_R4_RDIV2         (1UL << 25)     ///< R4 DB25 - reference divide by 2
+#define ADF4355_R4_DOUBLER       (1UL << 26)     ///< R4 DB26 - reference doubler
+#define ADF4355_R10_ADCDIV_SHIFT 6               ///< R10 DB13:DB6 - ADC clock divider
+#define ADF4355_R10_ADCDIV_MASK  (0xFFUL << ADF4355_R10_ADCDIV_SHIFT)
+#define ADF4355_R6_RFDIV_SHIFT  21              ///< R6 DB23:DB21 - RF output divider select
+#define ADF4355_R6_RFDIV_MASK   (0x7UL << ADF4355_R6_RFDIV_SHIFT)
+
+/*
+ * Frequency plan - N = INT + (FRAC1 + FRAC2 / MOD2) / MOD1, fVCO = N x fPFD, RFout = fVCO / 2^rf_div_sel
+ */
+typedef struct {
+    uint16_t int_val;       ///< INT, 16 bits
+    uint32_t frac1;         ///< FRAC1, 24 bits
+    uint16_t frac2;         ///< FRAC2, 14 bits
+    uint16_t mod2;          ///< MOD2, 14 bits
+    uint8_t  rf_div_sel;    ///< RF output divider select, divider = 2^rf_div_sel (1 to 64)
+    uint32_t r0;            ///< R0 word, autocalibration enabled
+    uint32_t r1;            ///< R1 word
+    uint32_t r2;            ///< R2 word
+} adf4355_plan_t;
+
+/*
+ * Two-phase programming plan, first pass at fPFD / 2 (R counter doubled), second pass at fPFD
+ */
+typedef struct {
+    adf4355_plan_t half;    ///< First pass values, for halved fPFD
+    adf4355_plan_t full;    ///< Second pass values, for desired fPFD
+} adf4355_two_phase_t;
+
+/*
+ * Function declarations
+ */
+bool adf4355_plan(uint64_t rfout_hz, uint32_t fpfd_hz, uint16_t mod2, adf4355_plan_t *plan);
+bool adf4355_plan_two_phase(uint64_t rfout_hz, uint32_t fpfd_hz, uint16_t mod2_half, uint16_t mod2_full,
+                            adf4355_two_phase_t *plan);
+uint32_t adf4355_r4_rcounter(uint32_t r4, uint16_t r);
+uint32_t adf4355_r6_rfdiv(uint32_t r6, uint8_t rf_div_sel);
+uint32_t adf4355_fpfd_hz(uint32_t ref_hz, uint32_t r4);
+uint32_t adf4355_adc_wait_ns(uint32_t fpfd_hz, uint32_t r10);
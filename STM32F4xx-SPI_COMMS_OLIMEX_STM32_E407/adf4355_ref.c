@@ -0,0 +1,143 @@
+/// @file adf4355_ref.c
+/// @brief Host reference build of the ADF4355 frequency plan calculator, not part of the firmware
+///
+/// Runs the same adf4355_freq.c on a PC and checks the two-phase plans against the R0,
+/// R1 and R2 words of the power-on tables in init_functions.c, 100 MHz fPFD:
+///
+///   gcc -O2 -o adf4355_ref adf4355_ref.c adf4355_freq.c
+///   adf4355_ref
+///
+/// Each case gives the output frequency, the MOD2 of both passes as the tables use them
+/// and the table words, first pass (fPFD / 2) then second pass. Words the tables do not
+/// hold are ADF4355_REF_NONE and only printed. One line per word and PASS or FAIL are
+/// printed, the result is the exit status.
+///
+/// The 5.0 GHz lines of the tables only change the first pass R0, the R1 and R2 words
+/// are the integer N words of the 5.4 GHz lines.
+///
+/// The first pass R1 of the 5.4 GHz table, 0x00200001, holds FRAC1 = 131072, 5.400390625
+/// GHz rather than the 5.4 GHz of its comment. The plan gives 0x00000001, the difference
+/// is allowed explicitly and reported as known.
+///
+/// @author Peter Ludlow
+
+#include <stdio.h>
+#include "adf4355_freq.h"
+
+#define ADF4355_REF_FPFD_HZ     100000000UL
+
+/// Word not in the power-on tables
+#define ADF4355_REF_NONE        0xFFFFFFFFUL
+
+/*
+ * One table example, words in the order R0, R1, R2
+ */
+typedef struct {
+    const char *name;
+    uint64_t    rfout_hz;
+    uint16_t    mod2_half;
+    uint16_t    mod2_full;
+    uint32_t    half[3];        // First pass, fPFD / 2
+    uint32_t    full[3];        // Second pass, fPFD
+} adf4355_ref_case_t;
+
+static const adf4355_ref_case_t cases[] = {
+    { "5.0 GHz",   5000000000ULL, 1024U, 1024U,
+      { 0x00200640UL, 0x00000001UL, 0x00004002UL }, { ADF4355_REF_NONE, 0x00000001UL, 0x00004002UL } },
+    { "5.4 GHz",   5400000000ULL, 1024U, 1024U,
+      { 0x002006C0UL, 0x00200001UL, 0x00004002UL }, { 0x00200360UL, 0x00000001UL, 0x00004002UL } },
+    { "5.402 GHz", 5402000000ULL, 5461U, 16383U,
+      { 0x002006C0UL, 0x00A3D701UL, 0x369D5552UL }, { 0x00200360UL, 0x0051EB81UL, 0x51EFFFF2UL } },
+};
+
+#define ADF4355_REF_CASES       (sizeof(cases) / sizeof(cases[0]))
+
+/*
+ * Known table difference, case, pass (0 first, 1 second) and register
+ */
+static const struct {
+    uint32_t c;
+    uint32_t pass;
+    uint32_t reg;
+} known[] = {
+    { 1U, 0U, 1U },
+};
+
+#define ADF4355_REF_KNOWN       (sizeof(known) / sizeof(known[0]))
+
+
+/*
+ *@brief  Returns true for an allowed table difference
+ */
+
+static bool is_known(uint32_t c, uint32_t pass, uint32_t reg){
+
+    uint32_t k;
+
+    for (k = 0U; k < ADF4355_REF_KNOWN; k++) {
+        if ((known[k].c == c) && (known[k].pass == pass) && (known[k].reg == reg)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+int main(void){
+
+    static const char *const pass_name[2] = { "fPFD / 2", "fPFD" };
+    adf4355_two_phase_t plan;
+    const adf4355_plan_t *p;
+    const uint32_t *table;
+    uint32_t words[3];
+    uint32_t c, pass, reg;
+    const char *verdict;
+    bool ok = true;
+
+    for (c = 0U; c < ADF4355_REF_CASES; c++) {
+        if (!adf4355_plan_two_phase(cases[c].rfout_hz, ADF4355_REF_FPFD_HZ, cases[c].mod2_half,
+                                    cases[c].mod2_full, &plan)) {
+            printf("%-10s no plan\n", cases[c].name);
+            ok = false;
+            continue;
+        }
+
+        for (pass = 0U; pass < 2U; pass++) {
+            p = (pass == 0U) ? &plan.half : &plan.full;
+            table = (pass == 0U) ? cases[c].half : cases[c].full;
+            words[0] = p->r0;
+            words[1] = p->r1;
+            words[2] = p->r2;
+
+            for (reg = 0U; reg < 3U; reg++) {
+                if (table[reg] == ADF4355_REF_NONE) {
+                    verdict = "not in the tables";
+                }
+                else if (words[reg] == table[reg]) {
+                    verdict = "ok";
+                }
+                else if (is_known(c, pass, reg)) {
+                    verdict = "known table difference";
+                }
+                else {
+                    verdict = "MISMATCH";
+                    ok = false;
+                }
+
+                printf("%-10s %-8s R%u  plan 0x%08X  table ", cases[c].name, pass_name[pass], (unsigned)reg,
+                       (unsigned)words[reg]);
+                if (table[reg] == ADF4355_REF_NONE) {
+                    printf("----------");
+                }
+                else {
+                    printf("0x%08X", (unsigned)table[reg]);
+                }
+                printf("  %s\n", verdict);
+            }
+        }
+    }
+
+    printf("%s\n", ok ? "PASS" : "FAIL");
+
+    return ok ? 0 : 1;
+}
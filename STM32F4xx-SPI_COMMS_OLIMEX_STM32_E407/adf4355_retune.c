@@ -0,0 +1,232 @@
+/// @file adf4355_retune.c
+/// @brief ADF4355 fast retune of an initialized synthesizer
+///
+/// Once the power-on sequence has been loaded only the frequency dependent registers
+/// are rewritten, in the datasheet frequency update order:
+///
+///   [R6 when the RF divider changes], R4 (counter reset = 1), R2, R1, R0 (autocal = 0),
+///   R4 (counter reset = 0), wait 16 ADC_CLK cycles, R0 (autocal = 1)
+///
+/// The words are sent in a single bus session by the sequence engine and the ADC_CLK
+/// wait is derived from the programmed fPFD (R4) and ADC clock divider (R10) rather
+/// than a fixed millisecond sleep. The wait is one or two system ticks, too coarse to
+/// time it with a sleep, so it is timed by the hardware delay timer.
+///
+/// This path cannot switch in under 100 uS. The 16 ADC_CLK cycles are mandatory before
+/// the autocalibration R0 write, ADC_CLK = fPFD / (4 x divider + 2), so with the divider
+/// of 250 of the power-on tables the wait alone is 160.3 uS at fPFD = 100 MHz (320.6 uS
+/// at 50 MHz). The seven words add about 1 uS each at the 42 MHz SPI clock, and the
+/// autocalibration and the loop settling follow the last word: the best case is about
+/// 160 uS plus the bus time, before the lock.
+///
+/// adf4355_retune_nocal() is the fast alternative for small steps: R2, R1 and R0 with
+/// autocalibration off, three words and no wait, the VCO stays on the band calibrated
+/// by the last adf4355_retune(). Both paths accumulate their plan to last word time in
+/// the retune measurement and arm the lock detector, the arm to lock time is the
+/// measured settling of the step (lock_detect_get_stats()).
+///
+/// @author Peter Ludlow
+
+#include "ch.h"
+#include "hal.h"
+#include "adf4355_retune.h"
+#include "reg_cache.h"
+#include "spi_device.h"
+#include "lock_detect.h"
+#include "hw_delay.h"
+#include "timing_probe.h"
+
+static uint8_t tx[7][4];
+static adf4355_retune_stats_t stats;
+static time_measurement_t retune_time;
+static bool retune_time_init = false;
+
+// VCO frequency of the last autocalibration, 0 until the first adf4355_retune()
+static uint64_t cal_vco_hz;
+
+
+/*
+ *@brief  Stores a 32-bit control word MSB first into a register table row
+ */
+
+static void word_put(uint8_t row[4], uint32_t word){
+
+    row[0] = (uint8_t)(word >> 24);
+    row[1] = (uint8_t)(word >> 16);
+    row[2] = (uint8_t)(word >> 8);
+    row[3] = (uint8_t)word;
+}
+
+/*
+ *@brief  Retunes the ADF4355 output, keeping the programmed fPFD
+ *@note   The ADF4355 must have been programmed (ADF4355_init() or ADF4355_init_frequency()). The time from
+ *        the frequency plan to the end of the last word is accumulated in the retune measurement, the lock detector is
+ *        armed so lock_detect_wait(LOCK_ADF4355) completes the retune. Returns false, without touching the
+ *        device, when the frequency cannot be synthesized
+ */
+
+bool adf4355_retune(uint64_t rfout_hz){
+
+    adf4355_plan_t plan;
+    spi_sequence_t seq;
+    SPIDriver *spip;
+    uint32_t r4, r6, fpfd, wait_ns;
+    uint8_t n = 0;
+    bool planned;
+
+    // R4 holds its address bits once the shadow image has been loaded
+    r4 = reg_cache_get(&ADF4355_regs, ADF4355_REG(4));
+    osalDbgAssert(r4 != 0U, "ADF4355 not programmed");
+
+    // Planned and validated before the measurement starts, a rejected frequency leaves no partial retune measurement,
+    // the plan has a probe of its own for the 20 uS budget
+    fpfd = adf4355_fpfd_hz(ADF4355_REF_HZ, r4);
+    PROBE_BEGIN("adf4355_plan");
+    planned = adf4355_plan(rfout_hz, fpfd, 0U, &plan);
+    PROBE_END("adf4355_plan");
+    if (!planned) {
+        return false;
+    }
+
+    if (!retune_time_init) {
+        chTMObjectInit(&retune_time);
+        retune_time_init = true;
+    }
+
+    chTMStartMeasurementX(&retune_time);
+    PROBE_BEGIN("adf4355_retune");
+
+    wait_ns = adf4355_adc_wait_ns(fpfd, reg_cache_get(&ADF4355_regs, ADF4355_REG(10)));
+
+    r6 = adf4355_r6_rfdiv(reg_cache_get(&ADF4355_regs, ADF4355_REG(6)), plan.rf_div_sel);
+    if (r6 != reg_cache_get(&ADF4355_regs, ADF4355_REG(6))) {
+        word_put(tx[n++], r6);
+    }
+    word_put(tx[n++], r4 | ADF4355_R4_COUNTER_RESET);
+    word_put(tx[n++], plan.r2);
+    word_put(tx[n++], plan.r1);
+    word_put(tx[n++], plan.r0 & ~ADF4355_R0_AUTOCAL);
+    word_put(tx[n++], r4 & ~ADF4355_R4_COUNTER_RESET);
+    word_put(tx[n], plan.r0);
+
+    seq.words = &tx[0][0];
+    seq.count = n;
+    seq.size  = 4;
+    seq.rx    = NULL;
+
+    lock_detect_arm(LOCK_ADF4355);
+    spip = spi_device_acquire(SPI_ADF4355);
+    spi_sequence_send(spip, &seq, 1);
+
+    hw_delay_ns(wait_ns);
+
+    seq.words = &tx[n][0];
+    seq.count = 1;
+    spi_sequence_send(spip, &seq, 1);
+    spi_device_release(SPI_ADF4355);
+
+    chTMStopMeasurementX(&retune_time);
+    PROBE_END("adf4355_retune");
+
+    reg_cache_sync(&ADF4355_regs, &tx[0][0], (uint8_t)(n + 1U));
+
+    cal_vco_hz = rfout_hz << plan.rf_div_sel;
+
+    stats.retunes++;
+    stats.words = n + 1U;
+    stats.adc_wait_ns = wait_ns;
+
+    return true;
+}
+
+/*
+ *@brief  Retunes the ADF4355 output without autocalibration, R2, R1 and R0 only
+ *@note   The VCO must stay within ADF4355_NOCAL_MAX_STEP_HZ of the frequency calibrated by the last
+ *        adf4355_retune(), on the same RF divider. Returns false, without touching the device, when it would
+ *        not or when there was no calibrated retune yet - adf4355_retune() is then needed, also after the
+ *        ADF4355 has been programmed again by ADF4355_init...(). Measured and armed for
+ *        lock_detect_wait(LOCK_ADF4355) as adf4355_retune()
+ */
+
+bool adf4355_retune_nocal(uint64_t rfout_hz){
+
+    adf4355_plan_t plan;
+    spi_sequence_t seq;
+    SPIDriver *spip;
+    uint32_t r4, r6;
+    uint64_t vco_hz;
+    bool planned;
+
+    r4 = reg_cache_get(&ADF4355_regs, ADF4355_REG(4));
+    osalDbgAssert(r4 != 0U, "ADF4355 not programmed");
+
+    if (cal_vco_hz == 0U) {
+        return false;
+    }
+
+    PROBE_BEGIN("adf4355_plan");
+    planned = adf4355_plan(rfout_hz, adf4355_fpfd_hz(ADF4355_REF_HZ, r4), 0U, &plan);
+    PROBE_END("adf4355_plan");
+    if (!planned) {
+        return false;
+    }
+
+    r6 = reg_cache_get(&ADF4355_regs, ADF4355_REG(6));
+    vco_hz = rfout_hz << plan.rf_div_sel;
+    if ((adf4355_r6_rfdiv(r6, plan.rf_div_sel) != r6) ||
+        (((vco_hz > cal_vco_hz) ? (vco_hz - cal_vco_hz) : (cal_vco_hz - vco_hz)) > ADF4355_NOCAL_MAX_STEP_HZ)) {
+        return false;
+    }
+
+    if (!retune_time_init) {
+        chTMObjectInit(&retune_time);
+        retune_time_init = true;
+    }
+
+    chTMStartMeasurementX(&retune_time);
+    PROBE_BEGIN("adf4355_retune_nocal");
+
+    word_put(tx[0], plan.r2);
+    word_put(tx[1], plan.r1);
+    word_put(tx[2], plan.r0 & ~ADF4355_R0_AUTOCAL);
+
+    seq.words = &tx[0][0];
+    seq.count = 3;
+    seq.size  = 4;
+    seq.rx    = NULL;
+
+    lock_detect_arm(LOCK_ADF4355);
+    spip = spi_device_acquire(SPI_ADF4355);
+    spi_sequence_send(spip, &seq, 1);
+    spi_device_release(SPI_ADF4355);
+
+    chTMStopMeasurementX(&retune_time);
+    PROBE_END("adf4355_retune_nocal");
+
+    reg_cache_sync(&ADF4355_regs, &tx[0][0], 3);
+
+    stats.retunes++;
+    stats.nocal++;
+    stats.words = 3U;
+    stats.adc_wait_ns = 0U;
+
+    return true;
+}
+
+/*
+ *@brief  Returns the retune statistics
+ */
+
+const adf4355_retune_stats_t *adf4355_retune_get_stats(void){
+
+    return &stats;
+}
+
+/*
+ *@brief  Returns the plan to last word time of the retunes (CPU cycles)
+ */
+
+const time_measurement_t *adf4355_retune_get_time(void){
+
+    return &retune_time;
+}
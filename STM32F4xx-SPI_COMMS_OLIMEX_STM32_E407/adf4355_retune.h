@@ -0,0 +1,35 @@
+/// @file adf4355_retune.h
+/// @brief Variable/Function Declarations - ADF4355 fast retune of an initialized synthesizer
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+#include "hal.h"
+#include "adf4355_freq.h"
+
+/// Largest VCO step from the last calibrated frequency retuned without autocalibration (Hz). Sized for
+/// the 5.4 to 5.402 GHz IF step, not a data sheet figure - a step leaving the calibrated VCO band shows
+/// up as lock_detect_wait(LOCK_ADF4355) timing out, confirm the figure on the board
+#if !defined(ADF4355_NOCAL_MAX_STEP_HZ)
+#define ADF4355_NOCAL_MAX_STEP_HZ   2000000U
+#endif
+
+/*
+ * Retune statistics
+ */
+typedef struct {
+    uint32_t retunes;       ///< Number of completed retunes
+    uint32_t nocal;         ///< Retunes of them without autocalibration
+    uint32_t words;         ///< Register words written by the last retune
+    uint32_t adc_wait_ns;   ///< ADC_CLK wait of the last retune, 0 without autocalibration
+} adf4355_retune_stats_t;
+
+/*
+ * Function declarations
+ */
+bool adf4355_retune(uint64_t rfout_hz);
+bool adf4355_retune_nocal(uint64_t rfout_hz);
+const adf4355_retune_stats_t *adf4355_retune_get_stats(void);
+const time_measurement_t *adf4355_retune_get_time(void);
@@ -0,0 +1,217 @@
+/// @file boot_seq.c
+/// @brief Dependency driven boot sequencer
+///
+/// Each step of a boot table declares the steps it depends on, a programming function
+/// and a wait condition (PLL lock, timed settle or an external condition). The sequencer
+/// programs every step whose prerequisites are complete, in table order, and while steps
+/// are waiting it keeps using the SPI bus for the independent ones, e.g. the ADA8282
+/// amplifiers are configured while the synthesizers are locking. When nothing can be
+/// programmed the thread sleeps until the next settle deadline or lock event.
+///
+/// Times are kept relative to the boot start, the 32-bit cycle counter only wraps after
+/// 25 S at 168 MHz.
+///
+/// The report gives the start, end of programming and completion time of every step and
+/// the critical path, i.e. the chain of prerequisites ending at the last step to complete.
+///
+/// @author Peter Ludlow
+
+#include "ch.h"
+#include "hal.h"
+#include "boot_seq.h"
+#include "lock_detect.h"
+#include "hw_delay.h"
+
+#define NS2CYCLES(ns)   ((rtcnt_t)(((uint64_t)STM32_HCLK * (ns)) / 1000000000U))
+#define CYCLES2NS(c)    ((uint32_t)(((uint64_t)(c) * 1000000000U) / STM32_HCLK))
+
+
+/*
+ *@brief  Deadline of a waiting step, relative to the boot start (CPU cycles)
+ */
+
+static rtcnt_t step_deadline(const boot_step_t *s, const boot_step_time_t *t){
+
+    uint32_t ms;
+
+    if (s->wait == BOOT_WAIT_SETTLE) {
+        return t->programmed + NS2CYCLES(s->param);
+    }
+    ms = (s->timeout_ms != 0U) ? s->timeout_ms : LOCK_DETECT_TIMEOUT_MS;
+
+    return t->programmed + NS2CYCLES(ms * 1000000U);
+}
+
+/*
+ *@brief  Checks the wait condition of a step
+ */
+
+static bool step_ready(const boot_step_t *s, const boot_step_time_t *t, rtcnt_t now){
+
+    switch (s->wait) {
+    case BOOT_WAIT_LOCK:
+        return lock_detect_poll((lock_device_t)s->param);
+    case BOOT_WAIT_SETTLE:
+        return (now - t->programmed) >= NS2CYCLES(s->param);
+    case BOOT_WAIT_COND:
+        return s->ready();
+    default:
+        return true;
+    }
+}
+
+/*
+ *@brief  Critical path - from the last step to complete, back through the latest prerequisite
+ */
+
+static void critical_path(const boot_step_t *steps, boot_report_t *report){
+
+    uint8_t rev[BOOT_MAX_STEPS];
+    uint8_t i, k, n = 0;
+    int last = -1;
+
+    for (i = 0; i < report->n; i++) {
+        if ((last < 0) || (report->step[i].done > report->step[last].done)) {
+            last = i;
+        }
+    }
+
+    while (last >= 0) {
+        rev[n++] = (uint8_t)last;
+        k = (uint8_t)last;
+        last = -1;
+        for (i = 0; i < report->n; i++) {
+            if (((steps[k].requires & BOOT_STEP(i)) != 0U) &&
+                ((last < 0) || (report->step[i].done > report->step[last].done))) {
+                last = i;
+            }
+        }
+    }
+
+    report->path_len = n;
+    for (i = 0; i < n; i++) {
+        report->path[i] = rev[n - 1U - i];
+    }
+}
+
+/*
+ *@brief  Runs a boot table
+ *@note   Prerequisites must refer to earlier entries of the table. A step whose prerequisite failed is not
+ *        programmed and is reported as failed. Returns true when every step completed
+ */
+
+bool boot_run(const boot_step_t *steps, uint8_t n, boot_report_t *report){
+
+    event_listener_t el[LOCK_DEVICE_COUNT];
+    uint32_t all = BOOT_STEP(n) - 1U;
+    uint32_t started = 0, done = 0;
+    rtcnt_t t0, now, wake, left;
+    boot_step_time_t *t;
+    systime_t ticks;
+    bool progress, poll;
+    uint8_t i;
+
+    osalDbgCheck((steps != NULL) && (report != NULL) && (n <= BOOT_MAX_STEPS));
+
+    report->n = n;
+    report->failed = 0;
+
+    for (i = 0; i < LOCK_DEVICE_COUNT; i++) {
+        chEvtRegisterMask(lock_detect_get_source((lock_device_t)i), &el[i], BOOT_LOCK_EVENT);
+    }
+
+    t0 = chSysGetRealtimeCounterX();
+
+    while (done != all) {
+        progress = false;
+
+        /*
+         * Program every step whose prerequisites are complete, skip those with a failed prerequisite
+         */
+
+        for (i = 0; i < n; i++) {
+            if (((started & BOOT_STEP(i)) != 0U) || ((steps[i].requires & ~done) != 0U)) {
+                continue;
+            }
+            t = &report->step[i];
+            started |= BOOT_STEP(i);
+            t->start = chSysGetRealtimeCounterX() - t0;
+
+            progress = true;
+
+            if ((steps[i].requires & report->failed) != 0U) {
+                t->programmed = t->done = t->start;
+                report->failed |= BOOT_STEP(i);
+                done |= BOOT_STEP(i);
+                continue;
+            }
+            if (steps[i].program != NULL) {
+                steps[i].program();
+            }
+            t->programmed = chSysGetRealtimeCounterX() - t0;
+        }
+
+        /*
+         * Complete the steps whose wait condition is met or has timed out, find the next deadline
+         */
+
+        now  = chSysGetRealtimeCounterX() - t0;
+        wake = now + NS2CYCLES(LOCK_DETECT_TIMEOUT_MS * 1000000U);
+        poll = false;
+
+        for (i = 0; i < n; i++) {
+            if (((started & ~done) & BOOT_STEP(i)) == 0U) {
+                continue;
+            }
+            t = &report->step[i];
+            if (step_ready(&steps[i], t, now)) {
+                t->done = now;
+                done |= BOOT_STEP(i);
+                progress = true;
+            }
+            else if (now >= step_deadline(&steps[i], t)) {
+                t->done = now;
+                done |= BOOT_STEP(i);
+                report->failed |= BOOT_STEP(i);
+                progress = true;
+            }
+            else {
+                if (step_deadline(&steps[i], t) < wake) {
+                    wake = step_deadline(&steps[i], t);
+                }
+                poll |= (steps[i].wait == BOOT_WAIT_COND);
+            }
+        }
+
+        if (progress) {
+            continue;
+        }
+
+        /*
+         * Nothing to do, sleep until the next deadline or lock, one tick at a time for polled conditions.
+         * A deadline closer than one tick is waited for on the hardware delay timer
+         */
+
+        left = wake - now;
+        if (!poll && (CYCLES2NS(left) < (1000000000U / CH_CFG_ST_FREQUENCY))) {
+            hw_delay_ns(CYCLES2NS(left));
+            continue;
+        }
+        ticks = US2ST(CYCLES2NS(left) / 1000U);
+        if (poll || (ticks == 0U)) {
+            ticks = 1;
+        }
+        (void) chEvtWaitAnyTimeout(BOOT_LOCK_EVENT, ticks);
+    }
+
+    report->total = chSysGetRealtimeCounterX() - t0;
+
+    for (i = 0; i < LOCK_DEVICE_COUNT; i++) {
+        chEvtUnregister(lock_detect_get_source((lock_device_t)i), &el[i]);
+    }
+    (void) chEvtGetAndClearEvents(BOOT_LOCK_EVENT);
+
+    critical_path(steps, report);
+
+    return report->failed == 0U;
+}
@@ -0,0 +1,69 @@
+/// @file boot_seq.h
+/// @brief Variable/Function Declarations - Dependency driven boot sequencer
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+#include "hal.h"
+
+/// Maximum number of steps of a boot table
+#define BOOT_MAX_STEPS          16
+
+/// Prerequisite mask bit of a step index
+#define BOOT_STEP(n)            ((uint32_t)1U << (n))
+
+/// Thread event used while waiting for a lock
+#if !defined(BOOT_LOCK_EVENT)
+#define BOOT_LOCK_EVENT         EVENT_MASK(30)
+#endif
+
+/*
+ * Wait condition of a step, after its programming
+ */
+typedef enum {
+    BOOT_WAIT_NONE = 0,     ///< Complete once programmed
+    BOOT_WAIT_LOCK,         ///< Wait for lock of the lock_device_t in param
+    BOOT_WAIT_SETTLE,       ///< Wait param nS after programming
+    BOOT_WAIT_COND          ///< Wait until ready() returns true, e.g. a power-good input
+} boot_wait_t;
+
+/*
+ * Boot step
+ */
+typedef struct {
+    const char   *name;             ///< Step name, for the report
+    uint32_t      requires;         ///< Prerequisite steps, BOOT_STEP() mask of earlier table entries
+    void        (*program)(void);   ///< SPI programming of the step, may be NULL
+    boot_wait_t   wait;             ///< Wait condition
+    uint32_t      param;            ///< Lock device or settle time (nS)
+    bool        (*ready)(void);     ///< BOOT_WAIT_COND condition
+    uint32_t      timeout_ms;       ///< Lock/condition timeout, 0 for LOCK_DETECT_TIMEOUT_MS
+} boot_step_t;
+
+/*
+ * Step timing, from the start of the boot (CPU cycles)
+ */
+typedef struct {
+    rtcnt_t start;          ///< Programming started
+    rtcnt_t programmed;     ///< Programming finished, wait started
+    rtcnt_t done;           ///< Wait condition met or failed
+} boot_step_time_t;
+
+/*
+ * Boot report
+ */
+typedef struct {
+    uint8_t          n;                         ///< Number of steps
+    uint32_t         failed;                    ///< Steps that timed out or whose prerequisites failed
+    rtcnt_t          total;                     ///< Boot duration (CPU cycles)
+    boot_step_time_t step[BOOT_MAX_STEPS];      ///< Per step timing
+    uint8_t          path_len;                  ///< Number of steps on the critical path
+    uint8_t          path[BOOT_MAX_STEPS];      ///< Critical path, first step first
+} boot_report_t;
+
+/*
+ * Function declarations
+ */
+bool boot_run(const boot_step_t *steps, uint8_t n, boot_report_t *report);
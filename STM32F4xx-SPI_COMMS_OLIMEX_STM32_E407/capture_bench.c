@@ -0,0 +1,89 @@
+/// @file capture_bench.c
+/// @brief Capture and range-Doppler throughput run
+///
+/// Runs the sample capture with the range-Doppler processing behind it for
+/// CAPTURE_BENCH_MS and reports the capture statistics, the chirp and sample
+/// throughput and the frames produced or dropped. Built with ADC_CAPTURE_SIMULATOR the
+/// sample generator of adc_capture_sim.c stands in for the AD9648 and the DCMI, so the
+/// whole chain from the buffer halves to the detections runs on a bare E407 board at
+/// one chirp per CAPTURE_BENCH_PERIOD_US.
+///
+/// The counters are sampled before and after the run, the report gives the
+/// difference, so the run may follow other captures.
+///
+/// @author Peter Ludlow
+
+#include "ch.h"
+#include "hal.h"
+#include "chprintf.h"
+#include "capture_bench.h"
+#include "timing_probe.h"
+
+static const cfar_config_t capture_bench_cfar = {
+        .mode = CFAR_CA, .guard = 2U, .train = 8U, .scale = CFAR_SCALE(3.0), .peak = true
+};
+
+static const rd_config_t capture_bench_rd = {
+        .range_n = 256U, .bins = 128U, .chirps = 32U, .period_us = CAPTURE_BENCH_PERIOD_US,
+        .cfar = &capture_bench_cfar
+};
+
+
+/*
+ *@brief  Runs the capture and the range-Doppler processing for CAPTURE_BENCH_MS
+ *@note   Returns false when the processing could not be started
+ */
+
+bool capture_benchmark(capture_bench_t *result){
+
+    adc_capture_stats_t start = *adc_capture_get_stats();
+    uint32_t frames = rd_get_stats()->frames;
+    uint32_t dropped = rd_get_stats()->dropped;
+    const adc_capture_stats_t *end;
+
+    if (!rd_start(&capture_bench_rd)) {
+        return false;
+    }
+    chThdSleepMilliseconds(CAPTURE_BENCH_MS);
+    rd_stop();
+
+    end = adc_capture_get_stats();
+    result->ms                    = CAPTURE_BENCH_MS;
+    result->capture               = *end;
+    result->capture.chirps        = end->chirps - start.chirps;
+    result->capture.samples       = end->samples - start.samples;
+    result->capture.overruns      = end->overruns - start.overruns;
+    result->capture.dcmi_overruns = end->dcmi_overruns - start.dcmi_overruns;
+    result->capture.dma_errors    = end->dma_errors - start.dma_errors;
+    result->capture.triggers      = end->triggers - start.triggers;
+    result->capture.realigns      = end->realigns - start.realigns;
+    result->frames                = rd_get_stats()->frames - frames;
+    result->dropped               = rd_get_stats()->dropped - dropped;
+    result->rd                    = *rd_get_stats();
+
+    return true;
+}
+
+/*
+ *@brief  Prints the capture statistics and the throughput of a run
+ */
+
+void capture_benchmark_report(BaseSequentialStream *chp, const capture_bench_t *result){
+
+    const adc_capture_stats_t *c = &result->capture;
+
+#if ADC_CAPTURE_SIMULATOR
+    chprintf(chp, "Capture throughput, sample generator, %u mS\r\n", result->ms);
+#else
+    chprintf(chp, "Capture throughput, DCMI, %u mS\r\n", result->ms);
+#endif
+    chprintf(chp, "  chirps %u  samples %u  chirps/s %u  samples/s per channel %u\r\n", c->chirps, c->samples,
+             (uint32_t)(((uint64_t)c->chirps * 1000U) / result->ms), (uint32_t)(((uint64_t)c->samples * 1000U) / result->ms));
+    chprintf(chp, "  overruns %u  DCMI overruns %u  DMA errors %u  triggers %u  realigns %u  max slip %u\r\n",
+             c->overruns, c->dcmi_overruns, c->dma_errors, c->triggers, c->realigns, c->max_slip);
+    chprintf(chp, "  max hold %u uS\r\n", (uint32_t)(((uint64_t)c->max_hold * 1000000U) / TIMING_PROBE_FREQ));
+    chprintf(chp, "  frames %u  dropped %u  frames/s %u\r\n", result->frames, result->dropped,
+             (result->frames * 1000U) / result->ms);
+    chprintf(chp, "  last range %u  turn %u  doppler %u  cfar %u (TIMING_PROBE_FREQ)\r\n", result->rd.range_time,
+             result->rd.turn_time, result->rd.doppler_time, result->rd.cfar_time);
+}
@@ -0,0 +1,38 @@
+/// @file capture_bench.h
+/// @brief Variable/Function Declarations - Capture and range-Doppler throughput run
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+#include "hal.h"
+#include "adc_capture.h"
+#include "range_doppler.h"
+
+/// Length of the run (mS)
+#if !defined(CAPTURE_BENCH_MS)
+#define CAPTURE_BENCH_MS            2000U
+#endif
+
+/// Chirp period of the sample generator, simulator only (uS)
+#if !defined(CAPTURE_BENCH_PERIOD_US)
+#define CAPTURE_BENCH_PERIOD_US     500U
+#endif
+
+/*
+ * Result of one run, counts over the run only
+ */
+typedef struct {
+    uint32_t            ms;         ///< Run time
+    adc_capture_stats_t capture;    ///< Capture statistics of the run, max_slip and max_hold since the boot
+    uint32_t            frames;     ///< Range-Doppler maps produced
+    uint32_t            dropped;    ///< Frames dropped
+    rd_stats_t          rd;         ///< Range-Doppler statistics at the end of the run
+} capture_bench_t;
+
+/*
+ * Function declarations
+ */
+bool capture_benchmark(capture_bench_t *result);
+void capture_benchmark_report(BaseSequentialStream *chp, const capture_bench_t *result);
@@ -0,0 +1,219 @@
+/// @file cfar.c
+/// @brief CA-CFAR and OS-CFAR detection over range profiles and range-Doppler maps
+///
+/// The detector runs along the range axis: each cell is compared with a noise estimate
+/// taken from the training cells on both sides of it, past the guard cells. Near the
+/// ends of the axis the window is clipped to the cells that exist.
+///
+/// The window is not rebuilt for every cell. Moving on by one cell, one cell enters and
+/// one leaves each side, so CA-CFAR keeps a running sum and count, O(1) per cell, and
+/// compares level * count with scale * sum without a division. OS-CFAR keeps the
+/// training cells in a sorted array updated by insertion and removal, a short memmove
+/// per cell instead of a sort of the whole window.
+///
+/// Range-Doppler maps ([bin][Doppler], as range_doppler.c produces them) are run one
+/// Doppler column at a time. With cfg->peak set only cells that are a local maximum in
+/// range and in Doppler are reported, so a target smeared over a few cells gives one
+/// detection.
+///
+/// @author Peter Ludlow
+
+#include <string.h>
+#include "cfar.h"
+
+
+/*===============================================================*/
+/*Training Window                                                */
+/*===============================================================*/
+
+typedef struct {
+    uint32_t sum;                           // Sum of the training cells
+    uint32_t count;                         // Training cells in the window
+    uint16_t sorted[2U * CFAR_MAX_TRAIN];   // Training cells in increasing order, OS-CFAR only
+    bool     os;
+} cfar_window_t;
+
+
+/*
+ *@brief  Adds a cell to the training window
+ */
+
+static inline void win_add(cfar_window_t *w, uint16_t v){
+
+    uint32_t i;
+
+    w->sum += v;
+    if (w->os) {
+        i = w->count;
+        while ((i > 0U) && (w->sorted[i - 1U] > v)) {
+            w->sorted[i] = w->sorted[i - 1U];
+            i--;
+        }
+        w->sorted[i] = v;
+    }
+    w->count++;
+}
+
+/*
+ *@brief  Removes a cell from the training window
+ */
+
+static inline void win_remove(cfar_window_t *w, uint16_t v){
+
+    uint32_t i = 0U;
+
+    w->sum -= v;
+    w->count--;
+    if (w->os) {
+        while (w->sorted[i] != v) {
+            i++;
+        }
+        memmove(&w->sorted[i], &w->sorted[i + 1U], (w->count - i) * sizeof(uint16_t));
+    }
+}
+
+/*
+ *@brief  Runs the detector along one range line, x[i * stride] for i = 0 .. n - 1
+ *@note   left and right are the Doppler neighbour lines for the peak test of a map, NULL for a range profile
+ */
+
+static void cfar_line(const uint16_t *x, uint32_t n, uint32_t stride, const cfar_config_t *cfg, uint16_t doppler,
+                      const uint16_t *left, const uint16_t *right, cfar_list_t *list){
+
+    int32_t g = cfg->guard;
+    int32_t t = cfg->train;
+    int32_t len = (int32_t)n;
+    int32_t i, j;
+    uint32_t full = 2U * (uint32_t)t;
+    uint32_t level, noise, rank;
+    cfar_detection_t *d;
+    cfar_window_t win;
+
+    win.sum = 0U;
+    win.count = 0U;
+    win.os = (cfg->mode == CFAR_OS);
+
+    // Leading window of cell 0, the lagging window starts empty
+    for (j = g + 1; (j <= (g + t)) && (j < len); j++) {
+        win_add(&win, x[j * stride]);
+    }
+
+    for (i = 0; i < len; i++) {
+        if (i > 0) {
+            j = i - g - 1;
+            if (j >= 0) {
+                win_add(&win, x[j * stride]);
+            }
+            j = i - g - t - 1;
+            if (j >= 0) {
+                win_remove(&win, x[j * stride]);
+            }
+            j = i + g;
+            if (j < len) {
+                win_remove(&win, x[j * stride]);
+            }
+            j = i + g + t;
+            if (j < len) {
+                win_add(&win, x[j * stride]);
+            }
+        }
+
+        if (win.count == 0U) {
+            continue;
+        }
+
+        level = x[i * stride];
+
+        if (win.os) {
+            rank = (win.count == full) ? cfg->rank : ((cfg->rank * win.count) / full);
+            noise = win.sorted[rank];
+            if ((level << 8) <= ((uint32_t)cfg->scale * noise)) {
+                continue;
+            }
+        }
+        else {
+            if (((level * win.count) << 8) <= ((uint64_t)cfg->scale * win.sum)) {
+                continue;
+            }
+            noise = win.sum / win.count;
+        }
+
+        if (cfg->peak) {
+            if (((i > 0) && (x[(i - 1) * stride] > level)) || ((i < (len - 1)) && (x[(i + 1) * stride] >= level))) {
+                continue;
+            }
+            if ((left != NULL) && ((left[i * stride] > level) || (right[i * stride] >= level))) {
+                continue;
+            }
+        }
+
+        if (list->count >= CFAR_MAX_DETECTIONS) {
+            list->overflow++;
+            continue;
+        }
+
+        d = &list->det[list->count++];
+        d->bin     = (uint16_t)i;
+        d->doppler = doppler;
+        d->level   = (uint16_t)level;
+        d->noise   = (uint16_t)noise;
+    }
+}
+
+/*
+ *@brief  Checks a detector configuration
+ */
+
+static bool cfar_config_ok(const cfar_config_t *cfg){
+
+    return (cfg->train > 0U) && (cfg->train <= CFAR_MAX_TRAIN) && (cfg->rank < (2U * cfg->train));
+}
+
+
+/*===============================================================*/
+/*Detectors                                                      */
+/*===============================================================*/
+
+/*
+ *@brief  Detects the targets of a range profile of n magnitudes, returns false on a bad configuration
+ *@note   The detections replace the content of list
+ */
+
+bool cfar_range(const uint16_t *x, uint32_t n, const cfar_config_t *cfg, cfar_list_t *list){
+
+    list->count = 0U;
+    list->overflow = 0U;
+
+    if (!cfar_config_ok(cfg)) {
+        return false;
+    }
+
+    cfar_line(x, n, 1U, cfg, 0U, NULL, NULL, list);
+
+    return true;
+}
+
+/*
+ *@brief  Detects the targets of a [bin][Doppler] magnitude map, returns false on a bad configuration
+ *@note   chirps is a power of two, the Doppler neighbours of the peak test wrap around
+ */
+
+bool cfar_map(const uint16_t *map, uint32_t bins, uint32_t chirps, const cfar_config_t *cfg, cfar_list_t *list){
+
+    uint32_t k;
+    uint32_t mask = chirps - 1U;
+
+    list->count = 0U;
+    list->overflow = 0U;
+
+    if (!cfar_config_ok(cfg) || ((chirps & mask) != 0U)) {
+        return false;
+    }
+
+    for (k = 0U; k < chirps; k++) {
+        cfar_line(&map[k], bins, chirps, cfg, (uint16_t)k,
+                  &map[(k - 1U) & mask], &map[(k + 1U) & mask], list);
+    }
+
+    return true;
+}
@@ -0,0 +1,65 @@
+/// @file cfar.h
+/// @brief Variable/Function Declarations - CA-CFAR and OS-CFAR detection over range profiles and range-Doppler maps
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/// Largest number of training cells on each side of the cell under test
+#define CFAR_MAX_TRAIN          32U
+
+/// Detections kept per frame, further detections are only counted
+#if !defined(CFAR_MAX_DETECTIONS)
+#define CFAR_MAX_DETECTIONS     64U
+#endif
+
+/// Threshold factor k (level > k * noise) as the Q8 value of cfar_config_t.scale
+#define CFAR_SCALE(k)           ((uint16_t)(((k) * 256.0) + 0.5))
+
+/*
+ * Noise estimators
+ */
+typedef enum {
+    CFAR_CA = 0,            ///< Cell averaging, mean of the training cells
+    CFAR_OS                 ///< Ordered statistic, rank-th smallest training cell, robust to neighbouring targets
+} cfar_mode_t;
+
+/*
+ * Detector configuration
+ */
+typedef struct {
+    cfar_mode_t mode;       ///< Noise estimator
+    uint8_t     guard;      ///< Guard cells on each side of the cell under test
+    uint8_t     train;      ///< Training cells on each side, 1 .. CFAR_MAX_TRAIN
+    uint8_t     rank;       ///< OS-CFAR rank of the noise estimate in the 2 * train sorted cells, 0 = smallest
+    uint16_t    scale;      ///< Threshold factor, Q8 - see CFAR_SCALE()
+    bool        peak;       ///< Keep local maxima only, along range and along Doppler
+} cfar_config_t;
+
+/*
+ * One detection
+ */
+typedef struct {
+    uint16_t bin;           ///< Range bin
+    uint16_t doppler;       ///< Doppler bin of the map, 0 for a range profile
+    uint16_t level;         ///< Cell level
+    uint16_t noise;         ///< Noise estimate of the cell
+} cfar_detection_t;
+
+/*
+ * Detection list of one frame
+ */
+typedef struct {
+    uint32_t         count;                     ///< Detections in det[]
+    uint32_t         overflow;                  ///< Detections that did not fit in det[]
+    cfar_detection_t det[CFAR_MAX_DETECTIONS];  ///< Detections, by Doppler bin then range bin
+} cfar_list_t;
+
+/*
+ * Function declarations
+ */
+bool cfar_range(const uint16_t *x, uint32_t n, const cfar_config_t *cfg, cfar_list_t *list);
+bool cfar_map(const uint16_t *map, uint32_t bins, uint32_t chirps, const cfar_config_t *cfg, cfar_list_t *list);
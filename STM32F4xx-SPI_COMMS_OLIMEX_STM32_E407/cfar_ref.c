@@ -0,0 +1,182 @@
+/// @file cfar_ref.c
+/// @brief Host reference build of the CFAR detectors, not part of the firmware
+///
+/// Runs the same cfar.c on a PC over magnitude maps dumped from the target or made up
+/// with synthetic targets in noise, and lists the detections:
+///
+///   gcc -O2 -o cfar_ref cfar_ref.c cfar.c -lm
+///   cfar_ref ca|os bins chirps guard train scale [rank] < map.bin
+///   cfar_ref ca|os synth seed guard train scale [rank]
+///
+/// The map is raw little endian 16-bit magnitudes, [bin][Doppler] as range_doppler.c
+/// produces it; chirps = 1 takes a range profile. scale is the threshold factor, e.g.
+/// 3.5. The detections are printed one per line, bin, Doppler bin, level and noise.
+///
+/// synth makes the map itself: a 128 x 32 map of Rayleigh noise from the seed with the
+/// six targets of synth_targets[] added, two of them two bins apart and one at the edge
+/// of the range axis. Every target must be detected in its own cell and at most
+/// CFAR_REF_SYNTH_FALSE other cells may be reported; the result is printed as PASS or
+/// FAIL and is the exit status. With 2 guard and 8 training cells, CA-CFAR at a scale
+/// of 4 and OS-CFAR at 3.5 (rank 12) pass for seeds 1 to 100.
+///
+/// @author Peter Ludlow
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "cfar.h"
+
+#define CFAR_REF_CELLS      65536U
+
+/// Synthetic map size and noise, sigma of each quadrature component
+#define CFAR_REF_SYNTH_BINS     128U
+#define CFAR_REF_SYNTH_CHIRPS   32U
+#define CFAR_REF_SYNTH_SIGMA    300.0
+
+/// False alarms allowed on a synthetic map, about 0.1% of the cells
+#define CFAR_REF_SYNTH_FALSE    4U
+
+/*
+ * Synthetic target, the amplitude is added to the noise magnitude of its cell
+ */
+typedef struct {
+    uint16_t bin;
+    uint16_t doppler;
+    uint16_t amplitude;
+} cfar_ref_target_t;
+
+static const cfar_ref_target_t synth_targets[] = {
+    {  10U,  5U,  4000U },
+    {  12U,  5U,  2500U },  // Two bins from the first, inside its guard cells
+    {  60U, 20U,  2500U },  // Weakest, 16 dB over the mean noise
+    { 100U, 31U,  3000U },  // Last Doppler bin
+    {   2U,  0U,  3000U },  // Clipped training window
+    {  64U, 16U, 20000U },  // Strong, four bins from the weakest
+};
+
+static uint16_t map[CFAR_REF_CELLS];
+static cfar_list_t list;
+
+
+/*
+ *@brief  Fills the map with Rayleigh noise and the synthetic targets
+ */
+
+static void synth_map(uint32_t seed){
+
+    uint32_t x = (seed != 0U) ? seed : 1U;
+    uint32_t i;
+    double u, v;
+
+    for (i = 0U; i < (CFAR_REF_SYNTH_BINS * CFAR_REF_SYNTH_CHIRPS); i++) {
+        // xorshift32, reproducible across hosts
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        u = ((double)x + 1.0) / 4294967296.0;
+        v = CFAR_REF_SYNTH_SIGMA * sqrt(-2.0 * log(u));
+        map[i] = (uint16_t)((v > 65535.0) ? 65535.0 : v);
+    }
+
+    for (i = 0U; i < (sizeof(synth_targets) / sizeof(synth_targets[0])); i++) {
+        uint32_t c = (synth_targets[i].bin * CFAR_REF_SYNTH_CHIRPS) + synth_targets[i].doppler;
+        uint32_t a = (uint32_t)map[c] + synth_targets[i].amplitude;
+        map[c] = (uint16_t)((a > 65535U) ? 65535U : a);
+    }
+}
+
+/*
+ *@brief  Checks the detections of a synthetic map, returns true when they pass
+ */
+
+static bool synth_check(void){
+
+    uint32_t targets = (uint32_t)(sizeof(synth_targets) / sizeof(synth_targets[0]));
+    uint32_t found = 0U;
+    uint32_t false_alarms = 0U;
+    uint32_t i, t;
+
+    for (t = 0U; t < targets; t++) {
+        for (i = 0U; i < list.count; i++) {
+            if ((list.det[i].bin == synth_targets[t].bin) && (list.det[i].doppler == synth_targets[t].doppler)) {
+                break;
+            }
+        }
+        if (i < list.count) {
+            found++;
+        }
+        else {
+            printf("missed target %u %u\n", synth_targets[t].bin, synth_targets[t].doppler);
+        }
+    }
+
+    false_alarms = list.count + list.overflow - found;
+    printf("%u of %u targets, %u false alarms\n", (unsigned)found, (unsigned)targets, (unsigned)false_alarms);
+
+    return (found == targets) && (false_alarms <= CFAR_REF_SYNTH_FALSE);
+}
+
+int main(int argc, char *argv[]){
+
+    cfar_config_t cfg;
+    uint32_t bins, chirps, i;
+    bool synth, ok;
+
+    if ((argc < 7) || (argc > 8) || ((strcmp(argv[1], "ca") != 0) && (strcmp(argv[1], "os") != 0))) {
+        fprintf(stderr, "usage: cfar_ref ca|os bins chirps guard train scale [rank]\n"
+                        "       cfar_ref ca|os synth seed guard train scale [rank]\n");
+        return 2;
+    }
+
+    synth = (strcmp(argv[2], "synth") == 0);
+    if (synth) {
+        bins   = CFAR_REF_SYNTH_BINS;
+        chirps = CFAR_REF_SYNTH_CHIRPS;
+    }
+    else {
+        bins   = (uint32_t)strtoul(argv[2], NULL, 0);
+        chirps = (uint32_t)strtoul(argv[3], NULL, 0);
+    }
+    if ((bins == 0U) || (chirps == 0U) || ((bins * chirps) > CFAR_REF_CELLS)) {
+        fprintf(stderr, "map size out of range\n");
+        return 2;
+    }
+
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.mode  = (argv[1][0] == 'o') ? CFAR_OS : CFAR_CA;
+    cfg.guard = (uint8_t)strtoul(argv[4], NULL, 0);
+    cfg.train = (uint8_t)strtoul(argv[5], NULL, 0);
+    cfg.scale = CFAR_SCALE(strtod(argv[6], NULL));
+    cfg.rank  = (argc == 8) ? (uint8_t)strtoul(argv[7], NULL, 0) : (uint8_t)((3U * cfg.train) / 2U);
+    cfg.peak  = true;
+
+    if (synth) {
+        synth_map((uint32_t)strtoul(argv[3], NULL, 0));
+    }
+    else if (fread(map, sizeof(uint16_t), bins * chirps, stdin) != (bins * chirps)) {
+        fprintf(stderr, "short input\n");
+        return 1;
+    }
+
+    ok = (chirps == 1U) ? cfar_range(map, bins, &cfg, &list) : cfar_map(map, bins, chirps, &cfg, &list);
+    if (!ok) {
+        fprintf(stderr, "unsupported configuration\n");
+        return 1;
+    }
+
+    for (i = 0U; i < list.count; i++) {
+        printf("%u %u %u %u\n", list.det[i].bin, list.det[i].doppler, list.det[i].level, list.det[i].noise);
+    }
+    if (list.overflow != 0U) {
+        fprintf(stderr, "%u detections not listed\n", (unsigned)list.overflow);
+    }
+
+    if (synth) {
+        ok = synth_check();
+        printf("%s\n", ok ? "PASS" : "FAIL");
+        return ok ? 0 : 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,174 @@
+/// @file decim.c
+/// @brief CIC and compensating FIR decimation of the captured sample pairs
+///
+/// The beat frequencies of interest sit in a small band around DC of the quadrature
+/// converter output, so the AD9648 can run at full rate for the analog anti-aliasing
+/// margin while the range FFT only sees the band it needs. A chirp of captured offset
+/// binary sample pairs is decimated in place into Q15 complex samples (cq15_t), the
+/// range FFT then runs on n / factor points.
+///
+/// The first stage is a third order CIC decimator, integrators at the converter rate
+/// and combs at the CIC output rate, wrapping 32-bit arithmetic with the gain R^3
+/// removed by a shift. The second stage is a 32 tap linear phase FIR decimating by 2
+/// that flattens the CIC droop over the pass band and attenuates what would alias. Only
+/// the kept outputs are computed, the polyphase saving, and each is 16 SMLAD dual
+/// multiply-accumulates per channel: the per channel delay lines hold 16-bit samples
+/// so a word load gives a sample pair and the taps are read as pairs the same way.
+///
+/// The filters start from rest at every chirp, the first DECIM_FIR_TAPS / 2 outputs
+/// carry the FIR start-up transient.
+///
+/// Response with the decim_fir.c taps, measured through decim_ref at the output rate
+/// fs_out: flat to 0.35 fs_out, -1.8 dB at 0.45 fs_out. The alias rejection depends on
+/// the band that folds onto the pass band:
+///  - 0.65 - 1.35 fs_out, above the FIR transition: -67 dB at worst near 0.65 fs_out,
+///    about -77 dB around 1.3 fs_out (1.2 - 1.4 fs_out, -73.5 dB at factor 4)
+///  - 1.65 - 2.35 fs_out, around the first CIC null: only -33 dB (factor 4) to -40 dB
+///    (factor 32) onto the 0.35 fs_out pass band edge, -48 to -57 dB onto 0.2 fs_out
+///  - higher bands, factors 8 and up: -51 dB or better
+/// Beats near the pass band edge are the ones to keep away from strong interferers.
+///
+/// @author Peter Ludlow
+
+#include <string.h>
+#include "decim.h"
+#include "dsp_simd.h"
+
+// CIC output scaled to 15 bits, half the Q15 range, so the FIR accumulator keeps a bit of headroom
+// over the sum of the tap magnitudes - the FIR output is shifted one bit less to restore the Q15 range
+#define DECIM_CIC_OUT_BITS      15U
+
+
+/*===============================================================*/
+/*Filter State                                                   */
+/*===============================================================*/
+
+// FIR delay lines, each sample is written twice so the newest DECIM_FIR_TAPS samples are always contiguous
+static int16_t fir_i[2U * DECIM_FIR_TAPS] __attribute__((aligned(4)));
+static int16_t fir_q[2U * DECIM_FIR_TAPS] __attribute__((aligned(4)));
+
+
+/*
+ *@brief  Log2 of the CIC factor of a supported overall decimation, 0 if not supported
+ */
+
+static uint32_t decim_cic_log2(uint32_t factor){
+
+    uint32_t r = factor / DECIM_FIR_FACTOR;
+    uint32_t l = 0U;
+
+    if ((factor < DECIM_MIN) || (factor > DECIM_MAX) || ((factor & (factor - 1U)) != 0U)) {
+        return 0U;
+    }
+
+    while (r > 1U) {
+        r >>= 1;
+        l++;
+    }
+
+    return l;
+}
+
+/*
+ *@brief  One FIR output from a delay line window of DECIM_FIR_TAPS samples, Q15
+ */
+
+static inline int32_t decim_fir_dot(const int16_t *h, const int16_t *x){
+
+    uint32_t k;
+    uint32_t hw, xw;
+    int32_t acc = 0;
+
+    for (k = 0U; k < DECIM_FIR_TAPS; k += 2U) {
+        memcpy(&hw, &h[k], sizeof(hw));
+        memcpy(&xw, &x[k], sizeof(xw));
+        acc = dsp_smlad(hw, xw, acc);
+    }
+
+    return dsp_sat16(acc >> (DECIM_CIC_OUT_BITS - 1U));
+}
+
+/*
+ *@brief  Returns true if the overall decimation factor is supported, a power of two DECIM_MIN .. DECIM_MAX
+ */
+
+bool decim_supported(uint32_t factor){
+
+    return decim_cic_log2(factor) != 0U;
+}
+
+/*
+ *@brief  Decimates n captured sample pairs (adc_sample_t) by factor in place into Q15 complex samples (cq15_t)
+ *@note   Returns the number of output samples, written from the start of buf, 0 if factor is not supported.
+ *        Input samples past the last multiple of factor are dropped
+ */
+
+uint32_t decim_to_q15(void *buf, uint32_t n, uint32_t factor){
+
+    uint32_t l = decim_cic_log2(factor);
+    uint32_t r = 1UL << l;
+    uint32_t shift = (DECIM_CIC_ORDER * l) + 14U - DECIM_CIC_OUT_BITS;
+    const int16_t *h;
+    uint32_t *x = buf;
+    uint32_t ia1 = 0U, ia2 = 0U, ia3 = 0U, ib1 = 0U, ib2 = 0U, ib3 = 0U;
+    uint32_t ca1 = 0U, ca2 = 0U, ca3 = 0U, cb1 = 0U, cb2 = 0U, cb3 = 0U;
+    uint32_t d1, d2;
+    int32_t va, vb;
+    uint32_t i, j, p, out;
+    uint32_t w;
+
+    if (l == 0U) {
+        return 0U;
+    }
+    h = decim_fir[l - 1U];
+    n -= n % factor;
+
+    memset(fir_i, 0, sizeof(fir_i));
+    memset(fir_q, 0, sizeof(fir_q));
+    p = DECIM_FIR_TAPS;
+    out = 0U;
+
+    for (i = 0U; i < n; i += r) {
+        // CIC integrators at the converter rate, the 14-bit values re-centred, modulo 2^32
+        for (j = i; j < (i + r); j++) {
+            w = x[j];
+            ia1 += (w & 0x3FFFU) - 0x2000U;
+            ia2 += ia1;
+            ia3 += ia2;
+            ib1 += ((w >> 16) & 0x3FFFU) - 0x2000U;
+            ib2 += ib1;
+            ib3 += ib2;
+        }
+
+        // CIC combs at the output rate, the result fits 32 bits signed again
+        d1 = ia3 - ca1;
+        ca1 = ia3;
+        d2 = d1 - ca2;
+        ca2 = d1;
+        va = (int32_t)(d2 - ca3) >> shift;
+        ca3 = d2;
+
+        d1 = ib3 - cb1;
+        cb1 = ib3;
+        d2 = d1 - cb2;
+        cb2 = d1;
+        vb = (int32_t)(d2 - cb3) >> shift;
+        cb3 = d2;
+
+        p--;
+        fir_i[p] = (int16_t)va;
+        fir_i[p + DECIM_FIR_TAPS] = (int16_t)va;
+        fir_q[p] = (int16_t)vb;
+        fir_q[p + DECIM_FIR_TAPS] = (int16_t)vb;
+
+        // FIR output on every second CIC output, p is then even and the windows word aligned
+        if ((p & 1U) == 0U) {
+            x[out++] = dsp_pkhbt(decim_fir_dot(h, &fir_i[p]), decim_fir_dot(h, &fir_q[p]));
+            if (p == 0U) {
+                p = DECIM_FIR_TAPS;
+            }
+        }
+    }
+
+    return out;
+}
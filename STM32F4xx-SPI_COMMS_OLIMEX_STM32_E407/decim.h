@@ -0,0 +1,33 @@
+/// @file decim.h
+/// @brief Variable/Function Declarations - CIC and compensating FIR decimation of the captured sample pairs
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/// CIC order, the FIR tables of decim_fir.c are generated for it
+#define DECIM_CIC_ORDER         3U
+
+/// CIC decimation factors with a FIR table, 2, 4, 8 and 16
+#define DECIM_CIC_FACTORS       4U
+
+/// Compensation FIR taps, even, the tables of decim_fir.c are generated for it
+#define DECIM_FIR_TAPS          32U
+
+/// Decimation of the compensation FIR
+#define DECIM_FIR_FACTOR        2U
+
+/// Overall decimation range, CIC factor times DECIM_FIR_FACTOR
+#define DECIM_MIN               4U
+#define DECIM_MAX               32U
+
+extern const int16_t decim_fir[DECIM_CIC_FACTORS][DECIM_FIR_TAPS];
+
+/*
+ * Function declarations
+ */
+bool decim_supported(uint32_t factor);
+uint32_t decim_to_q15(void *buf, uint32_t n, uint32_t factor);
@@ -0,0 +1,61 @@
+/// @file decim_bench.c
+/// @brief Decimation cycle count benchmark
+///
+/// Times decim.c on DECIM_BENCH_SAMPLES synthetic sample pairs for each factor,
+/// averaged over DECIM_BENCH_ROUNDS runs, and reports the input rate per channel the
+/// CPU alone could sustain. The input is refilled outside the timed region.
+///
+/// @author Peter Ludlow
+
+#include "ch.h"
+#include "hal.h"
+#include "chprintf.h"
+#include "adc_capture.h"
+#include "decim.h"
+#include "decim_bench.h"
+#include "timing_probe.h"
+
+static adc_sample_t bench_chirp[DECIM_BENCH_SAMPLES];
+
+static const uint32_t bench_factors[DECIM_BENCH_FACTORS] = { 4U, 8U, 16U, 32U };
+
+
+/*
+ *@brief  Measures the cycles per decimation run of every benchmark factor
+ */
+
+void decim_benchmark(decim_bench_t results[DECIM_BENCH_FACTORS]){
+
+    uint32_t f, r;
+    rtcnt_t t;
+    uint32_t sum;
+
+    for (f = 0U; f < DECIM_BENCH_FACTORS; f++) {
+        sum = 0U;
+        for (r = 0U; r < DECIM_BENCH_ROUNDS; r++) {
+            adc_capture_fill_test_chirp(bench_chirp, DECIM_BENCH_SAMPLES, r);
+            t = TIMING_PROBE_NOW();
+            (void) decim_to_q15(bench_chirp, DECIM_BENCH_SAMPLES, bench_factors[f]);
+            sum += TIMING_PROBE_NOW() - t;
+        }
+
+        results[f].factor = bench_factors[f];
+        results[f].cycles = sum / DECIM_BENCH_ROUNDS;
+        results[f].rate   = (uint32_t)(((uint64_t)TIMING_PROBE_FREQ * DECIM_BENCH_SAMPLES) / results[f].cycles);
+    }
+}
+
+/*
+ *@brief  Prints the decimation benchmark results, one line per factor
+ */
+
+void decim_benchmark_report(BaseSequentialStream *chp, const decim_bench_t results[DECIM_BENCH_FACTORS]){
+
+    uint32_t f;
+
+    chprintf(chp, "Decimation cycles per %u sample pairs\r\n", DECIM_BENCH_SAMPLES);
+    chprintf(chp, "  factor    cycles  samples/s per channel\r\n");
+    for (f = 0U; f < DECIM_BENCH_FACTORS; f++) {
+        chprintf(chp, "  %6u %9u %22u\r\n", results[f].factor, results[f].cycles, results[f].rate);
+    }
+}
@@ -0,0 +1,33 @@
+/// @file decim_bench.h
+/// @brief Variable/Function Declarations - Decimation cycle count benchmark
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+#include "hal.h"
+
+/// Decimation factors benchmarked, 4/8/16/32
+#define DECIM_BENCH_FACTORS     4U
+
+/// Input sample pairs per decimation run
+#define DECIM_BENCH_SAMPLES     1024U
+
+/// Runs averaged per factor
+#define DECIM_BENCH_ROUNDS      8U
+
+/*
+ * Cycles per decimation run of one factor
+ */
+typedef struct {
+    uint32_t factor;        ///< Overall decimation
+    uint32_t cycles;        ///< DECIM_BENCH_SAMPLES input sample pairs
+    uint32_t rate;          ///< Input samples per second per channel the CPU alone allows
+} decim_bench_t;
+
+/*
+ * Function declarations
+ */
+void decim_benchmark(decim_bench_t results[DECIM_BENCH_FACTORS]);
+void decim_benchmark_report(BaseSequentialStream *chp, const decim_bench_t results[DECIM_BENCH_FACTORS]);
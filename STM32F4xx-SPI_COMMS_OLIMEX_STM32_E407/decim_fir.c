@@ -0,0 +1,39 @@
+/// @file decim_fir.c
+/// @brief CIC compensation FIR tables, generated by decim_fir.py - do not edit
+///
+/// @author Peter Ludlow
+
+#include <stdint.h>
+#include "decim.h"
+
+#if (DECIM_FIR_TAPS != 32) || (DECIM_CIC_ORDER != 3)
+#error "decim_fir.c out of date, regenerate with decim_fir.py"
+#endif
+
+/// Q15 taps by CIC factor 2, 4, 8, 16 - pass band 0.20, stop band 0.30 of the CIC output rate
+const int16_t decim_fir[DECIM_CIC_FACTORS][DECIM_FIR_TAPS] __attribute__((aligned(4))) = {
+    {   // R = 2
+           -43,    -25,    123,     87,   -262,   -213,    483,    442,
+          -824,   -848,   1361,   1625,  -2321,  -3557,   4746,  15610,
+         15610,   4746,  -3557,  -2321,   1625,   1361,   -848,   -824,
+           442,    483,   -213,   -262,     87,    123,    -25,    -43,
+    },
+    {   // R = 4
+           -46,    -26,    130,     93,   -276,   -227,    508,    471,
+          -864,   -906,   1420,   1739,  -2394,  -3808,   4679,  15891,
+         15891,   4679,  -3808,  -2394,   1739,   1420,   -906,   -864,
+           471,    508,   -227,   -276,     93,    130,    -26,    -46,
+    },
+    {   // R = 8
+           -47,    -27,    132,     95,   -280,   -231,    515,    479,
+          -875,   -921,   1435,   1769,  -2412,  -3872,   4661,  15963,
+         15963,   4661,  -3872,  -2412,   1769,   1435,   -921,   -875,
+           479,    515,   -231,   -280,     95,    132,    -27,    -47,
+    },
+    {   // R = 16
+           -47,    -27,    132,     95,   -280,   -232,    516,    481,
+          -877,   -925,   1439,   1776,  -2417,  -3888,   4657,  15981,
+         15981,   4657,  -3888,  -2417,   1776,   1439,   -925,   -877,
+           481,    516,   -232,   -280,     95,    132,    -27,    -47,
+    },
+};
@@ -0,0 +1,111 @@
+#!/usr/bin/env python
+# Generates decim_fir.c, the CIC compensation FIR tables of the decimation stage
+#
+#   python decim_fir.py > decim_fir.c
+#
+# One table per CIC decimation factor R = 2, 4, 8, 16 for a CIC of order CIC_ORDER.
+# Each is a linear phase FIR of FIR_TAPS Q15 taps, decimating by 2, designed by
+# weighted least squares: the inverse CIC droop up to PASS_EDGE and zero from
+# STOP_EDGE, both in cycles per sample at the FIR input (CIC output) rate. The
+# stop band starts where it aliases onto the pass band edge after the decimation by 2.
+# It only covers the band the FIR itself folds, the bands around multiples of the CIC
+# output rate are left to the CIC nulls - the measured response is in decim.c.
+# The taps are scaled to a DC gain of exactly 1.0.
+#
+# Pure Python, no numpy, so "make tables" runs it wherever the Makefile runs.
+
+import math
+
+CIC_ORDER = 3
+CIC_FACTORS = [2, 4, 8, 16]
+FIR_TAPS = 32
+PASS_EDGE = 0.2
+STOP_EDGE = 0.3
+STOP_WEIGHT = 20.0
+GRID = 2048
+
+
+def cic_gain(f, r):
+    if f == 0.0:
+        return 1.0
+    return abs(math.sin(math.pi * f) / (r * math.sin(math.pi * f / r))) ** CIC_ORDER
+
+
+def solve(a, b):
+    # Gaussian elimination with partial pivoting
+    n = len(b)
+    m = [row[:] + [b[i]] for i, row in enumerate(a)]
+    for c in range(n):
+        p = max(range(c, n), key=lambda i: abs(m[i][c]))
+        m[c], m[p] = m[p], m[c]
+        for i in range(c + 1, n):
+            f = m[i][c] / m[c][c]
+            for j in range(c, n + 1):
+                m[i][j] -= f * m[c][j]
+    x = [0.0] * n
+    for i in range(n - 1, -1, -1):
+        x[i] = (m[i][n] - sum(m[i][j] * x[j] for j in range(i + 1, n))) / m[i][i]
+    return x
+
+
+def design(r):
+    # Symmetric even length: H(f) = sum 2 a[m] cos(2 pi f (m + 1/2)), a[m] = h[N/2 - 1 - m]
+    half = FIR_TAPS // 2
+    ata = [[0.0] * half for _ in range(half)]
+    atb = [0.0] * half
+    for g in range(GRID + 1):
+        f = 0.5 * g / GRID
+        if f <= PASS_EDGE:
+            d, w = 1.0 / cic_gain(f, r), 1.0
+        elif f >= STOP_EDGE:
+            d, w = 0.0, STOP_WEIGHT
+        else:
+            continue
+        basis = [2.0 * math.cos(2.0 * math.pi * f * (m + 0.5)) for m in range(half)]
+        for i in range(half):
+            atb[i] += w * basis[i] * d
+            for j in range(half):
+                ata[i][j] += w * basis[i] * basis[j]
+    a = solve(ata, atb)
+    h = [a[half - 1 - k] for k in range(half)]
+    h = h + h[::-1]
+
+    # Q15, DC gain exactly 32768 - the rounding error goes to the centre taps
+    dc = sum(h)
+    q = [int(round(v / dc * 32768.0)) for v in h]
+    err = 32768 - sum(q)
+    q[half - 1] += err // 2
+    q[half] += err - err // 2
+    return q
+
+
+def main():
+    out = []
+    out.append('/// @file decim_fir.c')
+    out.append('/// @brief CIC compensation FIR tables, generated by decim_fir.py - do not edit')
+    out.append('///')
+    out.append('/// @author Peter Ludlow')
+    out.append('')
+    out.append('#include <stdint.h>')
+    out.append('#include "decim.h"')
+    out.append('')
+    out.append('#if (DECIM_FIR_TAPS != %d) || (DECIM_CIC_ORDER != %d)' % (FIR_TAPS, CIC_ORDER))
+    out.append('#error "decim_fir.c out of date, regenerate with decim_fir.py"')
+    out.append('#endif')
+    out.append('')
+    out.append('/// Q15 taps by CIC factor 2, 4, 8, 16 - pass band %.2f, stop band %.2f of the CIC output rate' %
+               (PASS_EDGE, STOP_EDGE))
+    out.append('const int16_t decim_fir[DECIM_CIC_FACTORS][DECIM_FIR_TAPS] __attribute__((aligned(4))) = {')
+    for r in CIC_FACTORS:
+        q = design(r)
+        out.append('    {   // R = %d' % r)
+        for i in range(0, FIR_TAPS, 8):
+            out.append('        ' + ', '.join('%6d' % v for v in q[i:i + 8]) + ',')
+        out.append('    },')
+    out.append('};')
+
+    print('\n'.join(out))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,66 @@
+/// @file decim_ref.c
+/// @brief Host reference build of the decimation stage, not part of the firmware
+///
+/// Runs the same decim.c on a PC, with the portable dsp_simd.h primitives, so the
+/// decimated output of a capture dump can be compared bit for bit with the target,
+/// and measures the host throughput:
+///
+///   gcc -O2 -o decim_ref decim_ref.c decim.c decim_fir.c
+///   decim_ref factor n < in.bin > out.bin
+///
+/// The input is n raw little endian sample pairs as captured, two 16-bit offset binary
+/// words, channel A first. The output is n / factor Q15 complex samples, re then im.
+/// The throughput, in input samples per second per channel, is printed on stderr.
+///
+/// @author Peter Ludlow
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "decim.h"
+
+#define DECIM_REF_MAX           65536U
+#define DECIM_REF_SECONDS       0.5
+
+static uint32_t in[DECIM_REF_MAX];
+static uint32_t buf[DECIM_REF_MAX];
+
+int main(int argc, char *argv[]){
+
+    uint32_t factor, n, out = 0U;
+    uint32_t runs = 0U;
+    clock_t start, t;
+
+    if (argc != 3) {
+        fprintf(stderr, "usage: decim_ref factor n\n");
+        return 2;
+    }
+
+    factor = (uint32_t)strtoul(argv[1], NULL, 0);
+    n      = (uint32_t)strtoul(argv[2], NULL, 0);
+    if (!decim_supported(factor) || (n < factor) || (n > DECIM_REF_MAX)) {
+        fprintf(stderr, "factor or n out of range\n");
+        return 2;
+    }
+
+    if (fread(in, sizeof(uint32_t), n, stdin) != n) {
+        fprintf(stderr, "short input\n");
+        return 1;
+    }
+
+    // Repeated on a fresh copy, the stage works in place - the copy is timed too, a small part
+    start = clock();
+    do {
+        memcpy(buf, in, n * sizeof(uint32_t));
+        out = decim_to_q15(buf, n, factor);
+        runs++;
+        t = clock();
+    } while ((double)(t - start) < (DECIM_REF_SECONDS * CLOCKS_PER_SEC));
+
+    (void) fwrite(buf, sizeof(uint32_t), out, stdout);
+    fprintf(stderr, "%.1f Msamples/s per channel\n",
+            ((double)n * runs * CLOCKS_PER_SEC) / ((double)(t - start) * 1e6));
+
+    return 0;
+}
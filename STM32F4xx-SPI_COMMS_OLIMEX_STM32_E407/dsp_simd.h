@@ -0,0 +1,156 @@
+/// @file dsp_simd.h
+/// @brief Cortex-M4 DSP extension (packed 16-bit SIMD) primitives with bit-exact portable equivalents
+///
+/// On a core with the DSP extension each primitive is a single instruction, elsewhere
+/// (host reference builds) it is plain C with the same result in every bit, including
+/// the truncation of the halving operations and the wrap-around of the 32-bit sums.
+///
+/// Packed words hold two signed 16-bit lanes, lane 0 in the low half.
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include <stdint.h>
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define DSP_SIMD_NATIVE     1
+#else
+#define DSP_SIMD_NATIVE     0
+#endif
+
+/// Packs two 16-bit values, lo in lane 0 (PKHBT)
+static inline uint32_t dsp_pkhbt(int32_t lo, int32_t hi){
+    return ((uint32_t)lo & 0xFFFFU) | ((uint32_t)hi << 16);
+}
+
+#if DSP_SIMD_NATIVE
+
+/// Lane-wise (x + y) / 2
+static inline uint32_t dsp_shadd16(uint32_t x, uint32_t y){
+    uint32_t r;
+    __asm__ ("shadd16 %0, %1, %2" : "=r" (r) : "r" (x), "r" (y));
+    return r;
+}
+
+/// Lane-wise (x - y) / 2
+static inline uint32_t dsp_shsub16(uint32_t x, uint32_t y){
+    uint32_t r;
+    __asm__ ("shsub16 %0, %1, %2" : "=r" (r) : "r" (x), "r" (y));
+    return r;
+}
+
+/// Lane 0 (x0 - y1) / 2, lane 1 (x1 + y0) / 2 - x + j * y for complex words, halved
+static inline uint32_t dsp_shasx(uint32_t x, uint32_t y){
+    uint32_t r;
+    __asm__ ("shasx %0, %1, %2" : "=r" (r) : "r" (x), "r" (y));
+    return r;
+}
+
+/// Lane 0 (x0 + y1) / 2, lane 1 (x1 - y0) / 2 - x - j * y for complex words, halved
+static inline uint32_t dsp_shsax(uint32_t x, uint32_t y){
+    uint32_t r;
+    __asm__ ("shsax %0, %1, %2" : "=r" (r) : "r" (x), "r" (y));
+    return r;
+}
+
+/// x0 * y0 + x1 * y1
+static inline int32_t dsp_smuad(uint32_t x, uint32_t y){
+    int32_t r;
+    __asm__ ("smuad %0, %1, %2" : "=r" (r) : "r" (x), "r" (y));
+    return r;
+}
+
+/// x0 * y1 - x1 * y0
+static inline int32_t dsp_smusdx(uint32_t x, uint32_t y){
+    int32_t r;
+    __asm__ ("smusdx %0, %1, %2" : "=r" (r) : "r" (x), "r" (y));
+    return r;
+}
+
+/// x0 * y0 + x1 * y1 + acc
+static inline int32_t dsp_smlad(uint32_t x, uint32_t y, int32_t acc){
+    int32_t r;
+    __asm__ ("smlad %0, %1, %2, %3" : "=r" (r) : "r" (x), "r" (y), "r" (acc));
+    return r;
+}
+
+/// Lane-wise saturating x - y
+static inline uint32_t dsp_qsub16(uint32_t x, uint32_t y){
+    uint32_t r;
+    __asm__ ("qsub16 %0, %1, %2" : "=r" (r) : "r" (x), "r" (y));
+    return r;
+}
+
+/// x saturated to 16 bits
+static inline int32_t dsp_sat16(int32_t x){
+    int32_t r;
+    __asm__ ("ssat %0, #16, %1" : "=r" (r) : "r" (x));
+    return r;
+}
+
+/// Bit order reversed
+static inline uint32_t dsp_rbit(uint32_t x){
+    uint32_t r;
+    __asm__ ("rbit %0, %1" : "=r" (r) : "r" (x));
+    return r;
+}
+
+#else
+
+static inline int32_t dsp_lo(uint32_t x){
+    return (int16_t)(x & 0xFFFFU);
+}
+
+static inline int32_t dsp_hi(uint32_t x){
+    return (int16_t)(x >> 16);
+}
+
+// Arithmetic shifts of negative values are assumed, as GCC does on every target
+
+static inline uint32_t dsp_shadd16(uint32_t x, uint32_t y){
+    return dsp_pkhbt((dsp_lo(x) + dsp_lo(y)) >> 1, (dsp_hi(x) + dsp_hi(y)) >> 1);
+}
+
+static inline uint32_t dsp_shsub16(uint32_t x, uint32_t y){
+    return dsp_pkhbt((dsp_lo(x) - dsp_lo(y)) >> 1, (dsp_hi(x) - dsp_hi(y)) >> 1);
+}
+
+static inline uint32_t dsp_shasx(uint32_t x, uint32_t y){
+    return dsp_pkhbt((dsp_lo(x) - dsp_hi(y)) >> 1, (dsp_hi(x) + dsp_lo(y)) >> 1);
+}
+
+static inline uint32_t dsp_shsax(uint32_t x, uint32_t y){
+    return dsp_pkhbt((dsp_lo(x) + dsp_hi(y)) >> 1, (dsp_hi(x) - dsp_lo(y)) >> 1);
+}
+
+static inline int32_t dsp_smuad(uint32_t x, uint32_t y){
+    return (int32_t)((uint32_t)(dsp_lo(x) * dsp_lo(y)) + (uint32_t)(dsp_hi(x) * dsp_hi(y)));
+}
+
+static inline int32_t dsp_smusdx(uint32_t x, uint32_t y){
+    return (int32_t)((uint32_t)(dsp_lo(x) * dsp_hi(y)) - (uint32_t)(dsp_hi(x) * dsp_lo(y)));
+}
+
+static inline int32_t dsp_smlad(uint32_t x, uint32_t y, int32_t acc){
+    return (int32_t)((uint32_t)dsp_smuad(x, y) + (uint32_t)acc);
+}
+
+static inline int32_t dsp_sat16(int32_t x){
+    return (x > 32767) ? 32767 : ((x < -32768) ? -32768 : x);
+}
+
+static inline uint32_t dsp_qsub16(uint32_t x, uint32_t y){
+    return dsp_pkhbt(dsp_sat16(dsp_lo(x) - dsp_lo(y)), dsp_sat16(dsp_hi(x) - dsp_hi(y)));
+}
+
+static inline uint32_t dsp_rbit(uint32_t x){
+    x = ((x >> 1) & 0x55555555U) | ((x & 0x55555555U) << 1);
+    x = ((x >> 2) & 0x33333333U) | ((x & 0x33333333U) << 2);
+    x = ((x >> 4) & 0x0F0F0F0FU) | ((x & 0x0F0F0F0FU) << 4);
+    x = ((x >> 8) & 0x00FF00FFU) | ((x & 0x00FF00FFU) << 8);
+    return (x >> 16) | (x << 16);
+}
+
+#endif
+
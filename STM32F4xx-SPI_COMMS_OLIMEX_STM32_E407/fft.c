@@ -0,0 +1,558 @@
+/// @file fft.c
+/// @brief Fixed-point in-place FFT, Q15 and Q31, complex and real
+///
+/// Radix-4 decimation in frequency, with one radix-2 stage at the end when the size
+/// is an odd power of two, followed by a bit reversal. The radix-4 butterflies store
+/// their outputs in 0, 2, 1, 3 order, which makes the mixed radix output plain bit
+/// reversed. Each radix-4 stage scales by 1/4 and the radix-2 stage by 1/2, so the
+/// result is DFT / n and cannot overflow.
+///
+/// The Q15 kernel works on complex samples as packed words (re low, im high): the
+/// butterflies are the M4 halving SIMD adds (SHADD16/SHSUB16/SHASX/SHSAX) and the
+/// twiddle rotation is one SMUAD and one SMUSDX. On other cores dsp_simd.h supplies
+/// bit-exact C, so a host build of this file is the reference for the target.
+///
+/// The real transforms take n real samples packed two per complex sample, run an n/2
+/// point complex FFT and split the result into bins 0..n/2. Bin 0 holds the DC term
+/// in re and the n/2 (Nyquist) term in im, both real. The scale is also 1/n.
+///
+/// The single precision float kernels follow the same structure without any scaling,
+/// their result is the plain DFT. They use the FPU when built with USE_FPU = hard and
+/// soft-float library calls otherwise, fft_bench.c compares both with the fixed point.
+///
+/// All twiddles come from the flash tables of fft_twiddle.c, generated by
+/// fft_twiddle.py for FFT_MAX_POINTS.
+///
+/// @author Peter Ludlow
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "fft.h"
+#include "dsp_simd.h"
+
+
+/*===============================================================*/
+/*Helpers                                                        */
+/*===============================================================*/
+
+/*
+ *@brief  Returns log2(n), 0 when n is not a power of two in FFT_MIN_POINTS..FFT_MAX_POINTS
+ */
+
+static uint32_t fft_log2(uint32_t n){
+
+    uint32_t bits = 0U;
+
+    if ((n < FFT_MIN_POINTS) || (n > FFT_MAX_POINTS) || ((n & (n - 1U)) != 0U)) {
+        return 0U;
+    }
+    while ((1UL << bits) < n) {
+        bits++;
+    }
+
+    return bits;
+}
+
+// One complex Q15 sample as a packed word, memcpy compiles to a single LDR/STR
+static inline uint32_t ld_q15(const cq15_t *p){
+
+    uint32_t v;
+
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline void st_q15(cq15_t *p, uint32_t v){
+
+    memcpy(p, &v, sizeof(v));
+}
+
+// x * (cos - j sin) of a packed twiddle word
+static inline uint32_t cmul_q15(uint32_t x, uint32_t w){
+
+    return dsp_pkhbt(dsp_sat16(dsp_smuad(x, w) >> 15), dsp_sat16(dsp_smusdx(w, x) >> 15));
+}
+
+static inline int32_t sat32(int64_t v){
+
+    return (v > INT32_MAX) ? INT32_MAX : ((v < INT32_MIN) ? INT32_MIN : (int32_t)v);
+}
+
+static inline int32_t hadd32(int32_t a, int32_t b){
+
+    return (int32_t)(((int64_t)a + b) >> 1);
+}
+
+static inline int32_t hsub32(int32_t a, int32_t b){
+
+    return (int32_t)(((int64_t)a - b) >> 1);
+}
+
+// x * (cos - j sin) of twiddle table entry m
+static inline cq31_t cmul_q31(cq31_t x, uint32_t m){
+
+    int64_t c = fft_twiddle_q31[2U * m];
+    int64_t s = fft_twiddle_q31[2U * m + 1U];
+    cq31_t r;
+
+    r.re = sat32((x.re * c + x.im * s) >> 31);
+    r.im = sat32((x.im * c - x.re * s) >> 31);
+    return r;
+}
+
+
+/*===============================================================*/
+/*Q15                                                            */
+/*===============================================================*/
+
+/*
+ *@brief  Radix-4 stage over butterflies of 4 * span points, 1/4 scaling
+ */
+
+static void radix4_q15(cq15_t *x, uint32_t n, uint32_t span){
+
+    uint32_t step = FFT_MAX_POINTS / (4U * span);
+    uint32_t j, g;
+    uint32_t a, b, c, d, s0, s1, s2, s3;
+    uint32_t w1, w2, w3;
+
+    for (j = 0U; j < span; j++) {
+        w1 = fft_twiddle_q15[j * step];
+        w2 = fft_twiddle_q15[2U * j * step];
+        w3 = fft_twiddle_q15[3U * j * step];
+
+        for (g = j; g < n; g += 4U * span) {
+            a = ld_q15(&x[g]);
+            b = ld_q15(&x[g + span]);
+            c = ld_q15(&x[g + 2U * span]);
+            d = ld_q15(&x[g + 3U * span]);
+
+            s0 = dsp_shadd16(a, c);
+            s1 = dsp_shsub16(a, c);
+            s2 = dsp_shadd16(b, d);
+            s3 = dsp_shsub16(b, d);
+
+            a = dsp_shadd16(s0, s2);        // a + b + c + d
+            b = dsp_shsub16(s0, s2);        // a - b + c - d
+            c = dsp_shsax(s1, s3);          // a - jb - c + jd
+            d = dsp_shasx(s1, s3);          // a + jb - c - jd
+
+            if (j != 0U) {
+                b = cmul_q15(b, w2);
+                c = cmul_q15(c, w1);
+                d = cmul_q15(d, w3);
+            }
+
+            st_q15(&x[g], a);
+            st_q15(&x[g + span], b);
+            st_q15(&x[g + 2U * span], c);
+            st_q15(&x[g + 3U * span], d);
+        }
+    }
+}
+
+/*
+ *@brief  Final radix-2 stage of odd powers of two, 1/2 scaling
+ */
+
+static void radix2_q15(cq15_t *x, uint32_t n){
+
+    uint32_t i, a, b;
+
+    for (i = 0U; i < n; i += 2U) {
+        a = ld_q15(&x[i]);
+        b = ld_q15(&x[i + 1U]);
+        st_q15(&x[i], dsp_shadd16(a, b));
+        st_q15(&x[i + 1U], dsp_shsub16(a, b));
+    }
+}
+
+static void bitrev_q15(cq15_t *x, uint32_t n, uint32_t bits){
+
+    uint32_t i, j, t;
+
+    for (i = 1U; i < n - 1U; i++) {
+        j = dsp_rbit(i) >> (32U - bits);
+        if (j > i) {
+            t = ld_q15(&x[i]);
+            st_q15(&x[i], ld_q15(&x[j]));
+            st_q15(&x[j], t);
+        }
+    }
+}
+
+/*
+ *@brief  In-place complex FFT of n Q15 samples, result DFT / n in natural order
+ *@note   Returns false, without touching x, when n is not a power of two in FFT_MIN_POINTS..FFT_MAX_POINTS
+ */
+
+bool fft_cfft_q15(cq15_t *x, uint32_t n){
+
+    uint32_t bits = fft_log2(n);
+    uint32_t span;
+
+    if (bits == 0U) {
+        return false;
+    }
+
+    for (span = n / 4U; span >= 2U; span /= 4U) {
+        radix4_q15(x, n, span);
+    }
+    if (span == 1U) {
+        radix4_q15(x, n, 1U);
+    }
+    else {
+        radix2_q15(x, n);
+    }
+
+    bitrev_q15(x, n, bits);
+
+    return true;
+}
+
+/*
+ *@brief  In-place FFT of n real Q15 samples packed two per complex sample, bins 0..n/2 - 1 as DFT / n
+ *@note   x[0].re is the DC term and x[0].im the n/2 term. n from 2 * FFT_MIN_POINTS to FFT_MAX_POINTS
+ */
+
+bool fft_rfft_q15(cq15_t *x, uint32_t n){
+
+    uint32_t half = n / 2U;
+    uint32_t step;
+    uint32_t k;
+    int32_t ar, ai, br, bi, er, ei, pr, pi;
+    uint32_t p;
+
+    if ((n > FFT_MAX_POINTS) || !fft_cfft_q15(x, half)) {
+        return false;
+    }
+    step = FFT_MAX_POINTS / n;
+
+    for (k = 0U; k <= half / 2U; k++) {
+        ar = x[k].re;
+        ai = x[k].im;
+        br = x[(half - k) & (half - 1U)].re;
+        bi = x[(half - k) & (half - 1U)].im;
+
+        // Even and odd sample spectra, odd one rotated by W^k. The halves are DFT * 2 / n, hence / 4
+        er = (ar + br) >> 2;
+        ei = (ai - bi) >> 2;
+        p  = cmul_q15(dsp_pkhbt((ar - br) >> 2, (ai + bi) >> 2), fft_twiddle_q15[k * step]);
+        pr = (int16_t)(p & 0xFFFFU);
+        pi = (int16_t)(p >> 16);
+
+        if (k == 0U) {
+            x[0].re = (int16_t)dsp_sat16(er + pi);
+            x[0].im = (int16_t)dsp_sat16(er - pi);
+            continue;
+        }
+
+        x[k].re = (int16_t)dsp_sat16(er + pi);
+        x[k].im = (int16_t)dsp_sat16(ei - pr);
+        if (k != half - k) {
+            x[half - k].re = (int16_t)dsp_sat16(er - pi);
+            x[half - k].im = (int16_t)dsp_sat16(-(ei + pr));
+        }
+    }
+
+    return true;
+}
+
+
+/*===============================================================*/
+/*Q31                                                            */
+/*===============================================================*/
+
+static void radix4_q31(cq31_t *x, uint32_t n, uint32_t span){
+
+    uint32_t step = FFT_MAX_POINTS / (4U * span);
+    uint32_t j, g;
+    cq31_t a, b, c, d, s0, s1, s2, s3;
+
+    for (j = 0U; j < span; j++) {
+        for (g = j; g < n; g += 4U * span) {
+            a = x[g];
+            b = x[g + span];
+            c = x[g + 2U * span];
+            d = x[g + 3U * span];
+
+            s0.re = hadd32(a.re, c.re);  s0.im = hadd32(a.im, c.im);
+            s1.re = hsub32(a.re, c.re);  s1.im = hsub32(a.im, c.im);
+            s2.re = hadd32(b.re, d.re);  s2.im = hadd32(b.im, d.im);
+            s3.re = hsub32(b.re, d.re);  s3.im = hsub32(b.im, d.im);
+
+            a.re = hadd32(s0.re, s2.re); a.im = hadd32(s0.im, s2.im);
+            b.re = hsub32(s0.re, s2.re); b.im = hsub32(s0.im, s2.im);
+            c.re = hadd32(s1.re, s3.im); c.im = hsub32(s1.im, s3.re);
+            d.re = hsub32(s1.re, s3.im); d.im = hadd32(s1.im, s3.re);
+
+            if (j != 0U) {
+                b = cmul_q31(b, 2U * j * step);
+                c = cmul_q31(c, j * step);
+                d = cmul_q31(d, 3U * j * step);
+            }
+
+            x[g] = a;
+            x[g + span] = b;
+            x[g + 2U * span] = c;
+            x[g + 3U * span] = d;
+        }
+    }
+}
+
+static void radix2_q31(cq31_t *x, uint32_t n){
+
+    uint32_t i;
+    cq31_t a, b;
+
+    for (i = 0U; i < n; i += 2U) {
+        a = x[i];
+        b = x[i + 1U];
+        x[i].re = hadd32(a.re, b.re);
+        x[i].im = hadd32(a.im, b.im);
+        x[i + 1U].re = hsub32(a.re, b.re);
+        x[i + 1U].im = hsub32(a.im, b.im);
+    }
+}
+
+static void bitrev_q31(cq31_t *x, uint32_t n, uint32_t bits){
+
+    uint32_t i, j;
+    cq31_t t;
+
+    for (i = 1U; i < n - 1U; i++) {
+        j = dsp_rbit(i) >> (32U - bits);
+        if (j > i) {
+            t = x[i];
+            x[i] = x[j];
+            x[j] = t;
+        }
+    }
+}
+
+/*
+ *@brief  In-place complex FFT of n Q31 samples, result DFT / n in natural order
+ */
+
+bool fft_cfft_q31(cq31_t *x, uint32_t n){
+
+    uint32_t bits = fft_log2(n);
+    uint32_t span;
+
+    if (bits == 0U) {
+        return false;
+    }
+
+    for (span = n / 4U; span >= 2U; span /= 4U) {
+        radix4_q31(x, n, span);
+    }
+    if (span == 1U) {
+        radix4_q31(x, n, 1U);
+    }
+    else {
+        radix2_q31(x, n);
+    }
+
+    bitrev_q31(x, n, bits);
+
+    return true;
+}
+
+/*
+ *@brief  In-place FFT of n real Q31 samples packed two per complex sample, same layout as fft_rfft_q15()
+ */
+
+bool fft_rfft_q31(cq31_t *x, uint32_t n){
+
+    uint32_t half = n / 2U;
+    uint32_t step;
+    uint32_t k;
+    cq31_t a, b, e, o, p;
+
+    if ((n > FFT_MAX_POINTS) || !fft_cfft_q31(x, half)) {
+        return false;
+    }
+    step = FFT_MAX_POINTS / n;
+
+    for (k = 0U; k <= half / 2U; k++) {
+        a = x[k];
+        b = x[(half - k) & (half - 1U)];
+
+        e.re = (int32_t)(((int64_t)a.re + b.re) >> 2);
+        e.im = (int32_t)(((int64_t)a.im - b.im) >> 2);
+        o.re = (int32_t)(((int64_t)a.re - b.re) >> 2);
+        o.im = (int32_t)(((int64_t)a.im + b.im) >> 2);
+        p = cmul_q31(o, k * step);
+
+        if (k == 0U) {
+            x[0].re = sat32((int64_t)e.re + p.im);
+            x[0].im = sat32((int64_t)e.re - p.im);
+            continue;
+        }
+
+        x[k].re = sat32((int64_t)e.re + p.im);
+        x[k].im = sat32((int64_t)e.im - p.re);
+        if (k != half - k) {
+            x[half - k].re = sat32((int64_t)e.re - p.im);
+            x[half - k].im = sat32(-((int64_t)e.im + p.re));
+        }
+    }
+
+    return true;
+}
+
+
+/*===============================================================*/
+/*Single Precision Float                                         */
+/*===============================================================*/
+
+// x * (cos - j sin) of twiddle table entry m
+static inline cf32_t cmul_f32(cf32_t x, uint32_t m){
+
+    float c = fft_twiddle_f32[2U * m];
+    float s = fft_twiddle_f32[2U * m + 1U];
+    cf32_t r;
+
+    r.re = x.re * c + x.im * s;
+    r.im = x.im * c - x.re * s;
+    return r;
+}
+
+static void radix4_f32(cf32_t *x, uint32_t n, uint32_t span){
+
+    uint32_t step = FFT_MAX_POINTS / (4U * span);
+    uint32_t j, g;
+    cf32_t a, b, c, d, s0, s1, s2, s3;
+
+    for (j = 0U; j < span; j++) {
+        for (g = j; g < n; g += 4U * span) {
+            a = x[g];
+            b = x[g + span];
+            c = x[g + 2U * span];
+            d = x[g + 3U * span];
+
+            s0.re = a.re + c.re;  s0.im = a.im + c.im;
+            s1.re = a.re - c.re;  s1.im = a.im - c.im;
+            s2.re = b.re + d.re;  s2.im = b.im + d.im;
+            s3.re = b.re - d.re;  s3.im = b.im - d.im;
+
+            a.re = s0.re + s2.re; a.im = s0.im + s2.im;
+            b.re = s0.re - s2.re; b.im = s0.im - s2.im;
+            c.re = s1.re + s3.im; c.im = s1.im - s3.re;
+            d.re = s1.re - s3.im; d.im = s1.im + s3.re;
+
+            if (j != 0U) {
+                b = cmul_f32(b, 2U * j * step);
+                c = cmul_f32(c, j * step);
+                d = cmul_f32(d, 3U * j * step);
+            }
+
+            x[g] = a;
+            x[g + span] = b;
+            x[g + 2U * span] = c;
+            x[g + 3U * span] = d;
+        }
+    }
+}
+
+static void radix2_f32(cf32_t *x, uint32_t n){
+
+    uint32_t i;
+    cf32_t a, b;
+
+    for (i = 0U; i < n; i += 2U) {
+        a = x[i];
+        b = x[i + 1U];
+        x[i].re = a.re + b.re;
+        x[i].im = a.im + b.im;
+        x[i + 1U].re = a.re - b.re;
+        x[i + 1U].im = a.im - b.im;
+    }
+}
+
+static void bitrev_f32(cf32_t *x, uint32_t n, uint32_t bits){
+
+    uint32_t i, j;
+    cf32_t t;
+
+    for (i = 1U; i < n - 1U; i++) {
+        j = dsp_rbit(i) >> (32U - bits);
+        if (j > i) {
+            t = x[i];
+            x[i] = x[j];
+            x[j] = t;
+        }
+    }
+}
+
+/*
+ *@brief  In-place complex FFT of n single precision samples, unscaled DFT in natural order
+ */
+
+bool fft_cfft_f32(cf32_t *x, uint32_t n){
+
+    uint32_t bits = fft_log2(n);
+    uint32_t span;
+
+    if (bits == 0U) {
+        return false;
+    }
+
+    for (span = n / 4U; span >= 2U; span /= 4U) {
+        radix4_f32(x, n, span);
+    }
+    if (span == 1U) {
+        radix4_f32(x, n, 1U);
+    }
+    else {
+        radix2_f32(x, n);
+    }
+
+    bitrev_f32(x, n, bits);
+
+    return true;
+}
+
+/*
+ *@brief  In-place FFT of n real single precision samples packed two per complex sample, same layout as fft_rfft_q15()
+ */
+
+bool fft_rfft_f32(cf32_t *x, uint32_t n){
+
+    uint32_t half = n / 2U;
+    uint32_t step;
+    uint32_t k;
+    cf32_t a, b, e, o, p;
+
+    if ((n > FFT_MAX_POINTS) || !fft_cfft_f32(x, half)) {
+        return false;
+    }
+    step = FFT_MAX_POINTS / n;
+
+    for (k = 0U; k <= half / 2U; k++) {
+        a = x[k];
+        b = x[(half - k) & (half - 1U)];
+
+        e.re = 0.5f * (a.re + b.re);
+        e.im = 0.5f * (a.im - b.im);
+        o.re = 0.5f * (a.re - b.re);
+        o.im = 0.5f * (a.im + b.im);
+        p = cmul_f32(o, k * step);
+
+        if (k == 0U) {
+            x[0].re = e.re + p.im;
+            x[0].im = e.re - p.im;
+            continue;
+        }
+
+        x[k].re = e.re + p.im;
+        x[k].im = e.im - p.re;
+        if (k != half - k) {
+            x[half - k].re = e.re - p.im;
+            x[half - k].im = -(e.im + p.re);
+        }
+    }
+
+    return true;
+}
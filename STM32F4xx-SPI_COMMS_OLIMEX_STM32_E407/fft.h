@@ -0,0 +1,62 @@
+/// @file fft.h
+/// @brief Variable/Function Declarations - Fixed-point in-place FFT, Q15 and Q31, complex and real
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/// Largest transform size, the twiddle tables of fft_twiddle.c are generated for it
+#define FFT_MAX_POINTS      1024U
+
+/// Smallest transform size
+#define FFT_MIN_POINTS      16U
+
+/*
+ * Complex samples, real part first - the Q15 layout matches the AD9648 sample pairs
+ */
+typedef struct {
+    int16_t re;
+    int16_t im;
+} cq15_t;
+
+typedef struct {
+    int32_t re;
+    int32_t im;
+} cq31_t;
+
+typedef struct {
+    float re;
+    float im;
+} cf32_t;
+
+extern const uint32_t fft_twiddle_q15[3U * FFT_MAX_POINTS / 4U];
+extern const int32_t  fft_twiddle_q31[2U * 3U * FFT_MAX_POINTS / 4U];
+extern const float    fft_twiddle_f32[2U * 3U * FFT_MAX_POINTS / 4U];
+
+/*
+ *@brief  Magnitude of a Q15 sample, alpha max plus beta min with alpha 15/16 and beta 15/32
+ *@note   Peak error 6.25%, no multiply - the result exceeds the Q15 range by up to 41%, hence 16 bits unsigned
+ */
+
+static inline uint16_t fft_mag_q15(cq15_t x){
+
+    uint32_t a = (uint32_t)((x.re < 0) ? -x.re : x.re);
+    uint32_t b = (uint32_t)((x.im < 0) ? -x.im : x.im);
+    uint32_t hi = (a > b) ? a : b;
+    uint32_t lo = (a > b) ? b : a;
+
+    return (uint16_t)(hi - (hi >> 4) + (lo >> 1) - (lo >> 5));
+}
+
+/*
+ * Function declarations
+ */
+bool fft_cfft_q15(cq15_t *x, uint32_t n);
+bool fft_cfft_q31(cq31_t *x, uint32_t n);
+bool fft_rfft_q15(cq15_t *x, uint32_t n);
+bool fft_rfft_q31(cq31_t *x, uint32_t n);
+bool fft_cfft_f32(cf32_t *x, uint32_t n);
+bool fft_rfft_f32(cf32_t *x, uint32_t n);
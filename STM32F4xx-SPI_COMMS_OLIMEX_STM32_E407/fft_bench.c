@@ -0,0 +1,130 @@
+/// @file fft_bench.c
+/// @brief FFT kernel cycle count benchmark
+///
+/// Times the Q15, Q31 and single precision float complex and real transforms at 256,
+/// 512 and 1024 points on the DWT cycle counter, averaged over FFT_BENCH_ROUNDS runs.
+/// The kernels run in constant time whatever the data, the input is refilled outside
+/// the timed region so only the kernel is counted.
+///
+/// The float figures depend on the build: soft-float library calls with USE_FPU = no,
+/// FPv4-SP instructions with USE_FPU = hard. The report names the variant, running
+/// both builds gives the soft-float, hard-float and fixed point figures side by side.
+///
+/// @author Peter Ludlow
+
+#include "ch.h"
+#include "hal.h"
+#include "chprintf.h"
+#include "fft.h"
+#include "fft_bench.h"
+#include "timing_probe.h"
+
+#if defined(__ARM_FP) && !CORTEX_USE_FPU
+#error "FPU code needs CORTEX_USE_FPU, the port must save the FPU context on thread switches"
+#endif
+
+#if defined(__ARM_PCS_VFP)
+#define FFT_BENCH_FLOAT_ABI     "hard-float (FPv4-SP)"
+#elif defined(__ARM_FP)
+#define FFT_BENCH_FLOAT_ABI     "softfp (FPv4-SP)"
+#else
+#define FFT_BENCH_FLOAT_ABI     "soft-float"
+#endif
+
+static cq15_t bench_q15[FFT_MAX_POINTS];
+static cq31_t bench_q31[FFT_MAX_POINTS];
+static cf32_t bench_f32[FFT_MAX_POINTS];
+
+static const uint32_t bench_sizes[FFT_BENCH_SIZES] = { 256U, 512U, 1024U };
+
+
+/*
+ *@brief  Fills both buffers with a deterministic test signal, two rotations picked from the twiddle table
+ */
+
+static void bench_fill(uint32_t n){
+
+    uint32_t i;
+    uint32_t w1, w2;
+
+    for (i = 0U; i < n; i++) {
+        w1 = fft_twiddle_q15[(5U * i) % (3U * FFT_MAX_POINTS / 4U)];
+        w2 = fft_twiddle_q15[(37U * i) % (3U * FFT_MAX_POINTS / 4U)];
+
+        bench_q15[i].re = (int16_t)(((int16_t)(w1 & 0xFFFFU) >> 1) + ((int16_t)(w2 & 0xFFFFU) >> 2));
+        bench_q15[i].im = (int16_t)(((int16_t)(w1 >> 16) >> 1) + ((int16_t)(w2 >> 16) >> 2));
+        bench_q31[i].re = (int32_t)bench_q15[i].re << 16;
+        bench_q31[i].im = (int32_t)bench_q15[i].im << 16;
+        bench_f32[i].re = (float)bench_q15[i].re * (1.0f / 32768.0f);
+        bench_f32[i].im = (float)bench_q15[i].im * (1.0f / 32768.0f);
+    }
+}
+
+/*
+ *@brief  Measures the cycles per transform of every kernel and size
+ */
+
+void fft_benchmark(fft_bench_t results[FFT_BENCH_SIZES]){
+
+    uint32_t s, r, n;
+    rtcnt_t t;
+    uint32_t sum[6];
+
+    for (s = 0U; s < FFT_BENCH_SIZES; s++) {
+        n = bench_sizes[s];
+        sum[0] = sum[1] = sum[2] = sum[3] = sum[4] = sum[5] = 0U;
+
+        for (r = 0U; r < FFT_BENCH_ROUNDS; r++) {
+            bench_fill(n);
+            t = TIMING_PROBE_NOW();
+            (void) fft_cfft_q15(bench_q15, n);
+            sum[0] += TIMING_PROBE_NOW() - t;
+
+            t = TIMING_PROBE_NOW();
+            (void) fft_cfft_q31(bench_q31, n);
+            sum[2] += TIMING_PROBE_NOW() - t;
+
+            t = TIMING_PROBE_NOW();
+            (void) fft_cfft_f32(bench_f32, n);
+            sum[4] += TIMING_PROBE_NOW() - t;
+
+            bench_fill(n);
+            t = TIMING_PROBE_NOW();
+            (void) fft_rfft_q15(bench_q15, n);
+            sum[1] += TIMING_PROBE_NOW() - t;
+
+            t = TIMING_PROBE_NOW();
+            (void) fft_rfft_q31(bench_q31, n);
+            sum[3] += TIMING_PROBE_NOW() - t;
+
+            t = TIMING_PROBE_NOW();
+            (void) fft_rfft_f32(bench_f32, n);
+            sum[5] += TIMING_PROBE_NOW() - t;
+        }
+
+        results[s].n        = n;
+        results[s].cfft_q15 = sum[0] / FFT_BENCH_ROUNDS;
+        results[s].rfft_q15 = sum[1] / FFT_BENCH_ROUNDS;
+        results[s].cfft_q31 = sum[2] / FFT_BENCH_ROUNDS;
+        results[s].rfft_q31 = sum[3] / FFT_BENCH_ROUNDS;
+        results[s].cfft_f32 = sum[4] / FFT_BENCH_ROUNDS;
+        results[s].rfft_f32 = sum[5] / FFT_BENCH_ROUNDS;
+    }
+}
+
+/*
+ *@brief  Prints the benchmark results, one line per size
+ */
+
+void fft_benchmark_report(BaseSequentialStream *chp, const fft_bench_t results[FFT_BENCH_SIZES]){
+
+    uint32_t s;
+
+    chprintf(chp, "FFT cycles, float ABI " FFT_BENCH_FLOAT_ABI "\r\n");
+    chprintf(chp, "     n  cfft_q15  rfft_q15  cfft_q31  rfft_q31  cfft_f32  rfft_f32\r\n");
+    for (s = 0U; s < FFT_BENCH_SIZES; s++) {
+        chprintf(chp, "  %4u %9u %9u %9u %9u %9u %9u\r\n", results[s].n,
+                 results[s].cfft_q15, results[s].rfft_q15, results[s].cfft_q31, results[s].rfft_q31,
+                 results[s].cfft_f32, results[s].rfft_f32);
+    }
+}
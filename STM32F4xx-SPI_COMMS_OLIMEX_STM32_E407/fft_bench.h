@@ -0,0 +1,34 @@
+/// @file fft_bench.h
+/// @brief Variable/Function Declarations - FFT kernel cycle count benchmark
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+#include "hal.h"
+
+/// Transform sizes benchmarked, 256/512/1024
+#define FFT_BENCH_SIZES         3U
+
+/// Runs averaged per size and kernel
+#define FFT_BENCH_ROUNDS        8U
+
+/*
+ * Cycles per transform of one size
+ */
+typedef struct {
+    uint32_t n;             ///< Transform size
+    uint32_t cfft_q15;      ///< Complex Q15, n points
+    uint32_t rfft_q15;      ///< Real Q15, n real points
+    uint32_t cfft_q31;      ///< Complex Q31, n points
+    uint32_t rfft_q31;      ///< Real Q31, n real points
+    uint32_t cfft_f32;      ///< Complex single precision, n points
+    uint32_t rfft_f32;      ///< Real single precision, n real points
+} fft_bench_t;
+
+/*
+ * Function declarations
+ */
+void fft_benchmark(fft_bench_t results[FFT_BENCH_SIZES]);
+void fft_benchmark_report(BaseSequentialStream *chp, const fft_bench_t results[FFT_BENCH_SIZES]);
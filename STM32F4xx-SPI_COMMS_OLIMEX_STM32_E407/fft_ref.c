@@ -0,0 +1,68 @@
+/// @file fft_ref.c
+/// @brief Host reference build of the FFT kernels, not part of the firmware
+///
+/// Runs the same fft.c on a PC, with the portable dsp_simd.h primitives, so transforms
+/// of sample dumps can be compared bit for bit with the target:
+///
+///   gcc -O2 -o fft_ref fft_ref.c fft.c fft_twiddle.c
+///   fft_ref cfft_q15 1024 < in.bin > out.bin
+///
+/// Input and output are raw little endian complex samples, re then im, 16 bits for the
+/// Q15 kernels and 32 bits for the Q31 kernels. The real kernels take n real samples.
+///
+/// @author Peter Ludlow
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fft.h"
+
+static cq15_t buf_q15[FFT_MAX_POINTS];
+static cq31_t buf_q31[FFT_MAX_POINTS];
+
+int main(int argc, char *argv[]){
+
+    uint32_t n;
+    size_t count;
+    bool ok;
+
+    if ((argc != 3) || (strlen(argv[1]) != 8U)) {
+        fprintf(stderr, "usage: fft_ref cfft_q15|rfft_q15|cfft_q31|rfft_q31 n\n");
+        return 2;
+    }
+
+    n = (uint32_t)strtoul(argv[2], NULL, 0);
+    count = (strncmp(argv[1], "rfft", 4) == 0) ? n / 2U : n;
+    if ((n == 0U) || (n > FFT_MAX_POINTS)) {
+        fprintf(stderr, "n out of range\n");
+        return 2;
+    }
+
+    if (strcmp(argv[1] + 5, "q15") == 0) {
+        if (fread(buf_q15, sizeof(cq15_t), count, stdin) != count) {
+            fprintf(stderr, "short input\n");
+            return 1;
+        }
+        ok = (argv[1][0] == 'r') ? fft_rfft_q15(buf_q15, n) : fft_cfft_q15(buf_q15, n);
+        if (ok) {
+            (void) fwrite(buf_q15, sizeof(cq15_t), count, stdout);
+        }
+    }
+    else {
+        if (fread(buf_q31, sizeof(cq31_t), count, stdin) != count) {
+            fprintf(stderr, "short input\n");
+            return 1;
+        }
+        ok = (argv[1][0] == 'r') ? fft_rfft_q31(buf_q31, n) : fft_cfft_q31(buf_q31, n);
+        if (ok) {
+            (void) fwrite(buf_q31, sizeof(cq31_t), count, stdout);
+        }
+    }
+
+    if (!ok) {
+        fprintf(stderr, "unsupported size\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,663 @@
+/// @file fft_twiddle.c
+/// @brief FFT twiddle tables, generated by fft_twiddle.py - do not edit
+///
+/// @author Peter Ludlow
+
+#include <stdint.h>
+#include "fft.h"
+
+#if FFT_MAX_POINTS != 1024
+#error "fft_twiddle.c out of date, regenerate with fft_twiddle.py"
+#endif
+
+/// cos | sin << 16, Q15
+const uint32_t fft_twiddle_q15[768] = {
+    0x00007FFF, 0x00C97FFF, 0x01927FFE, 0x025B7FFA, 0x03247FF6, 0x03ED7FF1,
+    0x04B67FEA, 0x057F7FE2, 0x06487FD9, 0x07117FCE, 0x07D97FC2, 0x08A27FB5,
+    0x096B7FA7, 0x0A337F98, 0x0AFB7F87, 0x0BC47F75, 0x0C8C7F62, 0x0D547F4E,
+    0x0E1C7F38, 0x0EE47F22, 0x0FAB7F0A, 0x10737EF0, 0x113A7ED6, 0x12017EBA,
+    0x12C87E9D, 0x138F7E7F, 0x14557E60, 0x151C7E3F, 0x15E27E1E, 0x16A87DFB,
+    0x176E7DD6, 0x18337DB1, 0x18F97D8A, 0x19BE7D63, 0x1A837D3A, 0x1B477D0F,
+    0x1C0C7CE4, 0x1CD07CB7, 0x1D937C89, 0x1E577C5A, 0x1F1A7C2A, 0x1FDD7BF9,
+    0x209F7BC6, 0x21627B92, 0x22247B5D, 0x22E57B27, 0x23A77AEF, 0x24677AB7,
+    0x25287A7D, 0x25E87A42, 0x26A87A06, 0x276879C9, 0x2827798A, 0x28E5794A,
+    0x29A4790A, 0x2A6278C8, 0x2B1F7885, 0x2BDC7840, 0x2C9977FB, 0x2D5577B4,
+    0x2E11776C, 0x2ECC7723, 0x2F8776D9, 0x3042768E, 0x30FC7642, 0x31B575F4,
+    0x326E75A6, 0x33277556, 0x33DF7505, 0x349774B3, 0x354E7460, 0x3604740B,
+    0x36BA73B6, 0x3770735F, 0x38257308, 0x38D972AF, 0x398D7255, 0x3A4071FA,
+    0x3AF3719E, 0x3BA57141, 0x3C5770E3, 0x3D087083, 0x3DB87023, 0x3E686FC2,
+    0x3F176F5F, 0x3FC66EFB, 0x40746E97, 0x41216E31, 0x41CE6DCA, 0x427A6D62,
+    0x43266CF9, 0x43D16C8F, 0x447B6C24, 0x45246BB8, 0x45CD6B4B, 0x46756ADD,
+    0x471D6A6E, 0x47C469FD, 0x486A698C, 0x490F691A, 0x49B468A7, 0x4A586832,
+    0x4AFB67BD, 0x4B9E6747, 0x4C4066D0, 0x4CE16657, 0x4D8165DE, 0x4E216564,
+    0x4EC064E9, 0x4F5E646C, 0x4FFB63EF, 0x50986371, 0x513462F2, 0x51CF6272,
+    0x526961F1, 0x5303616F, 0x539B60EC, 0x54336068, 0x54CA5FE4, 0x55605F5E,
+    0x55F65ED7, 0x568A5E50, 0x571E5DC8, 0x57B15D3E, 0x58435CB4, 0x58D45C29,
+    0x59645B9D, 0x59F45B10, 0x5A825A82, 0x5B1059F4, 0x5B9D5964, 0x5C2958D4,
+    0x5CB45843, 0x5D3E57B1, 0x5DC8571E, 0x5E50568A, 0x5ED755F6, 0x5F5E5560,
+    0x5FE454CA, 0x60685433, 0x60EC539B, 0x616F5303, 0x61F15269, 0x627251CF,
+    0x62F25134, 0x63715098, 0x63EF4FFB, 0x646C4F5E, 0x64E94EC0, 0x65644E21,
+    0x65DE4D81, 0x66574CE1, 0x66D04C40, 0x67474B9E, 0x67BD4AFB, 0x68324A58,
+    0x68A749B4, 0x691A490F, 0x698C486A, 0x69FD47C4, 0x6A6E471D, 0x6ADD4675,
+    0x6B4B45CD, 0x6BB84524, 0x6C24447B, 0x6C8F43D1, 0x6CF94326, 0x6D62427A,
+    0x6DCA41CE, 0x6E314121, 0x6E974074, 0x6EFB3FC6, 0x6F5F3F17, 0x6FC23E68,
+    0x70233DB8, 0x70833D08, 0x70E33C57, 0x71413BA5, 0x719E3AF3, 0x71FA3A40,
+    0x7255398D, 0x72AF38D9, 0x73083825, 0x735F3770, 0x73B636BA, 0x740B3604,
+    0x7460354E, 0x74B33497, 0x750533DF, 0x75563327, 0x75A6326E, 0x75F431B5,
+    0x764230FC, 0x768E3042, 0x76D92F87, 0x77232ECC, 0x776C2E11, 0x77B42D55,
+    0x77FB2C99, 0x78402BDC, 0x78852B1F, 0x78C82A62, 0x790A29A4, 0x794A28E5,
+    0x798A2827, 0x79C92768, 0x7A0626A8, 0x7A4225E8, 0x7A7D2528, 0x7AB72467,
+    0x7AEF23A7, 0x7B2722E5, 0x7B5D2224, 0x7B922162, 0x7BC6209F, 0x7BF91FDD,
+    0x7C2A1F1A, 0x7C5A1E57, 0x7C891D93, 0x7CB71CD0, 0x7CE41C0C, 0x7D0F1B47,
+    0x7D3A1A83, 0x7D6319BE, 0x7D8A18F9, 0x7DB11833, 0x7DD6176E, 0x7DFB16A8,
+    0x7E1E15E2, 0x7E3F151C, 0x7E601455, 0x7E7F138F, 0x7E9D12C8, 0x7EBA1201,
+    0x7ED6113A, 0x7EF01073, 0x7F0A0FAB, 0x7F220EE4, 0x7F380E1C, 0x7F4E0D54,
+    0x7F620C8C, 0x7F750BC4, 0x7F870AFB, 0x7F980A33, 0x7FA7096B, 0x7FB508A2,
+    0x7FC207D9, 0x7FCE0711, 0x7FD90648, 0x7FE2057F, 0x7FEA04B6, 0x7FF103ED,
+    0x7FF60324, 0x7FFA025B, 0x7FFE0192, 0x7FFF00C9, 0x7FFF0000, 0x7FFFFF37,
+    0x7FFEFE6E, 0x7FFAFDA5, 0x7FF6FCDC, 0x7FF1FC13, 0x7FEAFB4A, 0x7FE2FA81,
+    0x7FD9F9B8, 0x7FCEF8EF, 0x7FC2F827, 0x7FB5F75E, 0x7FA7F695, 0x7F98F5CD,
+    0x7F87F505, 0x7F75F43C, 0x7F62F374, 0x7F4EF2AC, 0x7F38F1E4, 0x7F22F11C,
+    0x7F0AF055, 0x7EF0EF8D, 0x7ED6EEC6, 0x7EBAEDFF, 0x7E9DED38, 0x7E7FEC71,
+    0x7E60EBAB, 0x7E3FEAE4, 0x7E1EEA1E, 0x7DFBE958, 0x7DD6E892, 0x7DB1E7CD,
+    0x7D8AE707, 0x7D63E642, 0x7D3AE57D, 0x7D0FE4B9, 0x7CE4E3F4, 0x7CB7E330,
+    0x7C89E26D, 0x7C5AE1A9, 0x7C2AE0E6, 0x7BF9E023, 0x7BC6DF61, 0x7B92DE9E,
+    0x7B5DDDDC, 0x7B27DD1B, 0x7AEFDC59, 0x7AB7DB99, 0x7A7DDAD8, 0x7A42DA18,
+    0x7A06D958, 0x79C9D898, 0x798AD7D9, 0x794AD71B, 0x790AD65C, 0x78C8D59E,
+    0x7885D4E1, 0x7840D424, 0x77FBD367, 0x77B4D2AB, 0x776CD1EF, 0x7723D134,
+    0x76D9D079, 0x768ECFBE, 0x7642CF04, 0x75F4CE4B, 0x75A6CD92, 0x7556CCD9,
+    0x7505CC21, 0x74B3CB69, 0x7460CAB2, 0x740BC9FC, 0x73B6C946, 0x735FC890,
+    0x7308C7DB, 0x72AFC727, 0x7255C673, 0x71FAC5C0, 0x719EC50D, 0x7141C45B,
+    0x70E3C3A9, 0x7083C2F8, 0x7023C248, 0x6FC2C198, 0x6F5FC0E9, 0x6EFBC03A,
+    0x6E97BF8C, 0x6E31BEDF, 0x6DCABE32, 0x6D62BD86, 0x6CF9BCDA, 0x6C8FBC2F,
+    0x6C24BB85, 0x6BB8BADC, 0x6B4BBA33, 0x6ADDB98B, 0x6A6EB8E3, 0x69FDB83C,
+    0x698CB796, 0x691AB6F1, 0x68A7B64C, 0x6832B5A8, 0x67BDB505, 0x6747B462,
+    0x66D0B3C0, 0x6657B31F, 0x65DEB27F, 0x6564B1DF, 0x64E9B140, 0x646CB0A2,
+    0x63EFB005, 0x6371AF68, 0x62F2AECC, 0x6272AE31, 0x61F1AD97, 0x616FACFD,
+    0x60ECAC65, 0x6068ABCD, 0x5FE4AB36, 0x5F5EAAA0, 0x5ED7AA0A, 0x5E50A976,
+    0x5DC8A8E2, 0x5D3EA84F, 0x5CB4A7BD, 0x5C29A72C, 0x5B9DA69C, 0x5B10A60C,
+    0x5A82A57E, 0x59F4A4F0, 0x5964A463, 0x58D4A3D7, 0x5843A34C, 0x57B1A2C2,
+    0x571EA238, 0x568AA1B0, 0x55F6A129, 0x5560A0A2, 0x54CAA01C, 0x54339F98,
+    0x539B9F14, 0x53039E91, 0x52699E0F, 0x51CF9D8E, 0x51349D0E, 0x50989C8F,
+    0x4FFB9C11, 0x4F5E9B94, 0x4EC09B17, 0x4E219A9C, 0x4D819A22, 0x4CE199A9,
+    0x4C409930, 0x4B9E98B9, 0x4AFB9843, 0x4A5897CE, 0x49B49759, 0x490F96E6,
+    0x486A9674, 0x47C49603, 0x471D9592, 0x46759523, 0x45CD94B5, 0x45249448,
+    0x447B93DC, 0x43D19371, 0x43269307, 0x427A929E, 0x41CE9236, 0x412191CF,
+    0x40749169, 0x3FC69105, 0x3F1790A1, 0x3E68903E, 0x3DB88FDD, 0x3D088F7D,
+    0x3C578F1D, 0x3BA58EBF, 0x3AF38E62, 0x3A408E06, 0x398D8DAB, 0x38D98D51,
+    0x38258CF8, 0x37708CA1, 0x36BA8C4A, 0x36048BF5, 0x354E8BA0, 0x34978B4D,
+    0x33DF8AFB, 0x33278AAA, 0x326E8A5A, 0x31B58A0C, 0x30FC89BE, 0x30428972,
+    0x2F878927, 0x2ECC88DD, 0x2E118894, 0x2D55884C, 0x2C998805, 0x2BDC87C0,
+    0x2B1F877B, 0x2A628738, 0x29A486F6, 0x28E586B6, 0x28278676, 0x27688637,
+    0x26A885FA, 0x25E885BE, 0x25288583, 0x24678549, 0x23A78511, 0x22E584D9,
+    0x222484A3, 0x2162846E, 0x209F843A, 0x1FDD8407, 0x1F1A83D6, 0x1E5783A6,
+    0x1D938377, 0x1CD08349, 0x1C0C831C, 0x1B4782F1, 0x1A8382C6, 0x19BE829D,
+    0x18F98276, 0x1833824F, 0x176E822A, 0x16A88205, 0x15E281E2, 0x151C81C1,
+    0x145581A0, 0x138F8181, 0x12C88163, 0x12018146, 0x113A812A, 0x10738110,
+    0x0FAB80F6, 0x0EE480DE, 0x0E1C80C8, 0x0D5480B2, 0x0C8C809E, 0x0BC4808B,
+    0x0AFB8079, 0x0A338068, 0x096B8059, 0x08A2804B, 0x07D9803E, 0x07118032,
+    0x06488027, 0x057F801E, 0x04B68016, 0x03ED800F, 0x0324800A, 0x025B8006,
+    0x01928002, 0x00C98001, 0x00008000, 0xFF378001, 0xFE6E8002, 0xFDA58006,
+    0xFCDC800A, 0xFC13800F, 0xFB4A8016, 0xFA81801E, 0xF9B88027, 0xF8EF8032,
+    0xF827803E, 0xF75E804B, 0xF6958059, 0xF5CD8068, 0xF5058079, 0xF43C808B,
+    0xF374809E, 0xF2AC80B2, 0xF1E480C8, 0xF11C80DE, 0xF05580F6, 0xEF8D8110,
+    0xEEC6812A, 0xEDFF8146, 0xED388163, 0xEC718181, 0xEBAB81A0, 0xEAE481C1,
+    0xEA1E81E2, 0xE9588205, 0xE892822A, 0xE7CD824F, 0xE7078276, 0xE642829D,
+    0xE57D82C6, 0xE4B982F1, 0xE3F4831C, 0xE3308349, 0xE26D8377, 0xE1A983A6,
+    0xE0E683D6, 0xE0238407, 0xDF61843A, 0xDE9E846E, 0xDDDC84A3, 0xDD1B84D9,
+    0xDC598511, 0xDB998549, 0xDAD88583, 0xDA1885BE, 0xD95885FA, 0xD8988637,
+    0xD7D98676, 0xD71B86B6, 0xD65C86F6, 0xD59E8738, 0xD4E1877B, 0xD42487C0,
+    0xD3678805, 0xD2AB884C, 0xD1EF8894, 0xD13488DD, 0xD0798927, 0xCFBE8972,
+    0xCF0489BE, 0xCE4B8A0C, 0xCD928A5A, 0xCCD98AAA, 0xCC218AFB, 0xCB698B4D,
+    0xCAB28BA0, 0xC9FC8BF5, 0xC9468C4A, 0xC8908CA1, 0xC7DB8CF8, 0xC7278D51,
+    0xC6738DAB, 0xC5C08E06, 0xC50D8E62, 0xC45B8EBF, 0xC3A98F1D, 0xC2F88F7D,
+    0xC2488FDD, 0xC198903E, 0xC0E990A1, 0xC03A9105, 0xBF8C9169, 0xBEDF91CF,
+    0xBE329236, 0xBD86929E, 0xBCDA9307, 0xBC2F9371, 0xBB8593DC, 0xBADC9448,
+    0xBA3394B5, 0xB98B9523, 0xB8E39592, 0xB83C9603, 0xB7969674, 0xB6F196E6,
+    0xB64C9759, 0xB5A897CE, 0xB5059843, 0xB46298B9, 0xB3C09930, 0xB31F99A9,
+    0xB27F9A22, 0xB1DF9A9C, 0xB1409B17, 0xB0A29B94, 0xB0059C11, 0xAF689C8F,
+    0xAECC9D0E, 0xAE319D8E, 0xAD979E0F, 0xACFD9E91, 0xAC659F14, 0xABCD9F98,
+    0xAB36A01C, 0xAAA0A0A2, 0xAA0AA129, 0xA976A1B0, 0xA8E2A238, 0xA84FA2C2,
+    0xA7BDA34C, 0xA72CA3D7, 0xA69CA463, 0xA60CA4F0, 0xA57EA57E, 0xA4F0A60C,
+    0xA463A69C, 0xA3D7A72C, 0xA34CA7BD, 0xA2C2A84F, 0xA238A8E2, 0xA1B0A976,
+    0xA129AA0A, 0xA0A2AAA0, 0xA01CAB36, 0x9F98ABCD, 0x9F14AC65, 0x9E91ACFD,
+    0x9E0FAD97, 0x9D8EAE31, 0x9D0EAECC, 0x9C8FAF68, 0x9C11B005, 0x9B94B0A2,
+    0x9B17B140, 0x9A9CB1DF, 0x9A22B27F, 0x99A9B31F, 0x9930B3C0, 0x98B9B462,
+    0x9843B505, 0x97CEB5A8, 0x9759B64C, 0x96E6B6F1, 0x9674B796, 0x9603B83C,
+    0x9592B8E3, 0x9523B98B, 0x94B5BA33, 0x9448BADC, 0x93DCBB85, 0x9371BC2F,
+    0x9307BCDA, 0x929EBD86, 0x9236BE32, 0x91CFBEDF, 0x9169BF8C, 0x9105C03A,
+    0x90A1C0E9, 0x903EC198, 0x8FDDC248, 0x8F7DC2F8, 0x8F1DC3A9, 0x8EBFC45B,
+    0x8E62C50D, 0x8E06C5C0, 0x8DABC673, 0x8D51C727, 0x8CF8C7DB, 0x8CA1C890,
+    0x8C4AC946, 0x8BF5C9FC, 0x8BA0CAB2, 0x8B4DCB69, 0x8AFBCC21, 0x8AAACCD9,
+    0x8A5ACD92, 0x8A0CCE4B, 0x89BECF04, 0x8972CFBE, 0x8927D079, 0x88DDD134,
+    0x8894D1EF, 0x884CD2AB, 0x8805D367, 0x87C0D424, 0x877BD4E1, 0x8738D59E,
+    0x86F6D65C, 0x86B6D71B, 0x8676D7D9, 0x8637D898, 0x85FAD958, 0x85BEDA18,
+    0x8583DAD8, 0x8549DB99, 0x8511DC59, 0x84D9DD1B, 0x84A3DDDC, 0x846EDE9E,
+    0x843ADF61, 0x8407E023, 0x83D6E0E6, 0x83A6E1A9, 0x8377E26D, 0x8349E330,
+    0x831CE3F4, 0x82F1E4B9, 0x82C6E57D, 0x829DE642, 0x8276E707, 0x824FE7CD,
+    0x822AE892, 0x8205E958, 0x81E2EA1E, 0x81C1EAE4, 0x81A0EBAB, 0x8181EC71,
+    0x8163ED38, 0x8146EDFF, 0x812AEEC6, 0x8110EF8D, 0x80F6F055, 0x80DEF11C,
+    0x80C8F1E4, 0x80B2F2AC, 0x809EF374, 0x808BF43C, 0x8079F505, 0x8068F5CD,
+    0x8059F695, 0x804BF75E, 0x803EF827, 0x8032F8EF, 0x8027F9B8, 0x801EFA81,
+    0x8016FB4A, 0x800FFC13, 0x800AFCDC, 0x8006FDA5, 0x8002FE6E, 0x8001FF37,
+};
+
+/// cos, sin pairs, Q31
+const int32_t fft_twiddle_q31[1536] = {
+    2147483647, 0, 2147443222, 13176712, 2147321946, 26352928,
+    2147119825, 39528151, 2146836866, 52701887, 2146473080, 65873638,
+    2146028480, 79042909, 2145503083, 92209205, 2144896910, 105372028,
+    2144209982, 118530885, 2143442326, 131685278, 2142593971, 144834714,
+    2141664948, 157978697, 2140655293, 171116733, 2139565043, 184248325,
+    2138394240, 197372981, 2137142927, 210490206, 2135811153, 223599506,
+    2134398966, 236700388, 2132906420, 249792358, 2131333572, 262874923,
+    2129680480, 275947592, 2127947206, 289009871, 2126133817, 302061269,
+    2124240380, 315101295, 2122266967, 328129457, 2120213651, 341145265,
+    2118080511, 354148230, 2115867626, 367137861, 2113575080, 380113669,
+    2111202959, 393075166, 2108751352, 406021865, 2106220352, 418953276,
+    2103610054, 431868915, 2100920556, 444768294, 2098151960, 457650927,
+    2095304370, 470516330, 2092377892, 483364019, 2089372638, 496193509,
+    2086288720, 509004318, 2083126254, 521795963, 2079885360, 534567963,
+    2076566160, 547319836, 2073168777, 560051104, 2069693342, 572761285,
+    2066139983, 585449903, 2062508835, 598116479, 2058800036, 610760536,
+    2055013723, 623381598, 2051150040, 635979190, 2047209133, 648552838,
+    2043191150, 661102068, 2039096241, 673626408, 2034924562, 686125387,
+    2030676269, 698598533, 2026351522, 711045377, 2021950484, 723465451,
+    2017473321, 735858287, 2012920201, 748223418, 2008291295, 760560380,
+    2003586779, 772868706, 1998806829, 785147934, 1993951625, 797397602,
+    1989021350, 809617249, 1984016189, 821806413, 1978936331, 833964638,
+    1973781967, 846091463, 1968553292, 858186435, 1963250501, 870249095,
+    1957873796, 882278992, 1952423377, 894275671, 1946899451, 906238681,
+    1941302225, 918167572, 1935631910, 930061894, 1929888720, 941921200,
+    1924072871, 953745043, 1918184581, 965532978, 1912224073, 977284562,
+    1906191570, 988999351, 1900087301, 1000676905, 1893911494, 1012316784,
+    1887664383, 1023918550, 1881346202, 1035481766, 1874957189, 1047005996,
+    1868497586, 1058490808, 1861967634, 1069935768, 1855367581, 1081340445,
+    1848697674, 1092704411, 1841958164, 1104027237, 1835149306, 1115308496,
+    1828271356, 1126547765, 1821324572, 1137744621, 1814309216, 1148898640,
+    1807225553, 1160009405, 1800073849, 1171076495, 1792854372, 1182099496,
+    1785567396, 1193077991, 1778213194, 1204011567, 1770792044, 1214899813,
+    1763304224, 1225742318, 1755750017, 1236538675, 1748129707, 1247288478,
+    1740443581, 1257991320, 1732691928, 1268646800, 1724875040, 1279254516,
+    1716993211, 1289814068, 1709046739, 1300325060, 1701035922, 1310787095,
+    1692961062, 1321199781, 1684822463, 1331562723, 1676620432, 1341875533,
+    1668355276, 1352137822, 1660027308, 1362349204, 1651636841, 1372509294,
+    1643184191, 1382617710, 1634669676, 1392674072, 1626093616, 1402678000,
+    1617456335, 1412629117, 1608758157, 1422527051, 1599999411, 1432371426,
+    1591180426, 1442161874, 1582301533, 1451898025, 1573363068, 1461579514,
+    1564365367, 1471205974, 1555308768, 1480777044, 1546193612, 1490292364,
+    1537020244, 1499751576, 1527789007, 1509154322, 1518500250, 1518500250,
+    1509154322, 1527789007, 1499751576, 1537020244, 1490292364, 1546193612,
+    1480777044, 1555308768, 1471205974, 1564365367, 1461579514, 1573363068,
+    1451898025, 1582301533, 1442161874, 1591180426, 1432371426, 1599999411,
+    1422527051, 1608758157, 1412629117, 1617456335, 1402678000, 1626093616,
+    1392674072, 1634669676, 1382617710, 1643184191, 1372509294, 1651636841,
+    1362349204, 1660027308, 1352137822, 1668355276, 1341875533, 1676620432,
+    1331562723, 1684822463, 1321199781, 1692961062, 1310787095, 1701035922,
+    1300325060, 1709046739, 1289814068, 1716993211, 1279254516, 1724875040,
+    1268646800, 1732691928, 1257991320, 1740443581, 1247288478, 1748129707,
+    1236538675, 1755750017, 1225742318, 1763304224, 1214899813, 1770792044,
+    1204011567, 1778213194, 1193077991, 1785567396, 1182099496, 1792854372,
+    1171076495, 1800073849, 1160009405, 1807225553, 1148898640, 1814309216,
+    1137744621, 1821324572, 1126547765, 1828271356, 1115308496, 1835149306,
+    1104027237, 1841958164, 1092704411, 1848697674, 1081340445, 1855367581,
+    1069935768, 1861967634, 1058490808, 1868497586, 1047005996, 1874957189,
+    1035481766, 1881346202, 1023918550, 1887664383, 1012316784, 1893911494,
+    1000676905, 1900087301, 988999351, 1906191570, 977284562, 1912224073,
+    965532978, 1918184581, 953745043, 1924072871, 941921200, 1929888720,
+    930061894, 1935631910, 918167572, 1941302225, 906238681, 1946899451,
+    894275671, 1952423377, 882278992, 1957873796, 870249095, 1963250501,
+    858186435, 1968553292, 846091463, 1973781967, 833964638, 1978936331,
+    821806413, 1984016189, 809617249, 1989021350, 797397602, 1993951625,
+    785147934, 1998806829, 772868706, 2003586779, 760560380, 2008291295,
+    748223418, 2012920201, 735858287, 2017473321, 723465451, 2021950484,
+    711045377, 2026351522, 698598533, 2030676269, 686125387, 2034924562,
+    673626408, 2039096241, 661102068, 2043191150, 648552838, 2047209133,
+    635979190, 2051150040, 623381598, 2055013723, 610760536, 2058800036,
+    598116479, 2062508835, 585449903, 2066139983, 572761285, 2069693342,
+    560051104, 2073168777, 547319836, 2076566160, 534567963, 2079885360,
+    521795963, 2083126254, 509004318, 2086288720, 496193509, 2089372638,
+    483364019, 2092377892, 470516330, 2095304370, 457650927, 2098151960,
+    444768294, 2100920556, 431868915, 2103610054, 418953276, 2106220352,
+    406021865, 2108751352, 393075166, 2111202959, 380113669, 2113575080,
+    367137861, 2115867626, 354148230, 2118080511, 341145265, 2120213651,
+    328129457, 2122266967, 315101295, 2124240380, 302061269, 2126133817,
+    289009871, 2127947206, 275947592, 2129680480, 262874923, 2131333572,
+    249792358, 2132906420, 236700388, 2134398966, 223599506, 2135811153,
+    210490206, 2137142927, 197372981, 2138394240, 184248325, 2139565043,
+    171116733, 2140655293, 157978697, 2141664948, 144834714, 2142593971,
+    131685278, 2143442326, 118530885, 2144209982, 105372028, 2144896910,
+    92209205, 2145503083, 79042909, 2146028480, 65873638, 2146473080,
+    52701887, 2146836866, 39528151, 2147119825, 26352928, 2147321946,
+    13176712, 2147443222, 0, 2147483647, -13176712, 2147443222,
+    -26352928, 2147321946, -39528151, 2147119825, -52701887, 2146836866,
+    -65873638, 2146473080, -79042909, 2146028480, -92209205, 2145503083,
+    -105372028, 2144896910, -118530885, 2144209982, -131685278, 2143442326,
+    -144834714, 2142593971, -157978697, 2141664948, -171116733, 2140655293,
+    -184248325, 2139565043, -197372981, 2138394240, -210490206, 2137142927,
+    -223599506, 2135811153, -236700388, 2134398966, -249792358, 2132906420,
+    -262874923, 2131333572, -275947592, 2129680480, -289009871, 2127947206,
+    -302061269, 2126133817, -315101295, 2124240380, -328129457, 2122266967,
+    -341145265, 2120213651, -354148230, 2118080511, -367137861, 2115867626,
+    -380113669, 2113575080, -393075166, 2111202959, -406021865, 2108751352,
+    -418953276, 2106220352, -431868915, 2103610054, -444768294, 2100920556,
+    -457650927, 2098151960, -470516330, 2095304370, -483364019, 2092377892,
+    -496193509, 2089372638, -509004318, 2086288720, -521795963, 2083126254,
+    -534567963, 2079885360, -547319836, 2076566160, -560051104, 2073168777,
+    -572761285, 2069693342, -585449903, 2066139983, -598116479, 2062508835,
+    -610760536, 2058800036, -623381598, 2055013723, -635979190, 2051150040,
+    -648552838, 2047209133, -661102068, 2043191150, -673626408, 2039096241,
+    -686125387, 2034924562, -698598533, 2030676269, -711045377, 2026351522,
+    -723465451, 2021950484, -735858287, 2017473321, -748223418, 2012920201,
+    -760560380, 2008291295, -772868706, 2003586779, -785147934, 1998806829,
+    -797397602, 1993951625, -809617249, 1989021350, -821806413, 1984016189,
+    -833964638, 1978936331, -846091463, 1973781967, -858186435, 1968553292,
+    -870249095, 1963250501, -882278992, 1957873796, -894275671, 1952423377,
+    -906238681, 1946899451, -918167572, 1941302225, -930061894, 1935631910,
+    -941921200, 1929888720, -953745043, 1924072871, -965532978, 1918184581,
+    -977284562, 1912224073, -988999351, 1906191570, -1000676905, 1900087301,
+    -1012316784, 1893911494, -1023918550, 1887664383, -1035481766, 1881346202,
+    -1047005996, 1874957189, -1058490808, 1868497586, -1069935768, 1861967634,
+    -1081340445, 1855367581, -1092704411, 1848697674, -1104027237, 1841958164,
+    -1115308496, 1835149306, -1126547765, 1828271356, -1137744621, 1821324572,
+    -1148898640, 1814309216, -1160009405, 1807225553, -1171076495, 1800073849,
+    -1182099496, 1792854372, -1193077991, 1785567396, -1204011567, 1778213194,
+    -1214899813, 1770792044, -1225742318, 1763304224, -1236538675, 1755750017,
+    -1247288478, 1748129707, -1257991320, 1740443581, -1268646800, 1732691928,
+    -1279254516, 1724875040, -1289814068, 1716993211, -1300325060, 1709046739,
+    -1310787095, 1701035922, -1321199781, 1692961062, -1331562723, 1684822463,
+    -1341875533, 1676620432, -1352137822, 1668355276, -1362349204, 1660027308,
+    -1372509294, 1651636841, -1382617710, 1643184191, -1392674072, 1634669676,
+    -1402678000, 1626093616, -1412629117, 1617456335, -1422527051, 1608758157,
+    -1432371426, 1599999411, -1442161874, 1591180426, -1451898025, 1582301533,
+    -1461579514, 1573363068, -1471205974, 1564365367, -1480777044, 1555308768,
+    -1490292364, 1546193612, -1499751576, 1537020244, -1509154322, 1527789007,
+    -1518500250, 1518500250, -1527789007, 1509154322, -1537020244, 1499751576,
+    -1546193612, 1490292364, -1555308768, 1480777044, -1564365367, 1471205974,
+    -1573363068, 1461579514, -1582301533, 1451898025, -1591180426, 1442161874,
+    -1599999411, 1432371426, -1608758157, 1422527051, -1617456335, 1412629117,
+    -1626093616, 1402678000, -1634669676, 1392674072, -1643184191, 1382617710,
+    -1651636841, 1372509294, -1660027308, 1362349204, -1668355276, 1352137822,
+    -1676620432, 1341875533, -1684822463, 1331562723, -1692961062, 1321199781,
+    -1701035922, 1310787095, -1709046739, 1300325060, -1716993211, 1289814068,
+    -1724875040, 1279254516, -1732691928, 1268646800, -1740443581, 1257991320,
+    -1748129707, 1247288478, -1755750017, 1236538675, -1763304224, 1225742318,
+    -1770792044, 1214899813, -1778213194, 1204011567, -1785567396, 1193077991,
+    -1792854372, 1182099496, -1800073849, 1171076495, -1807225553, 1160009405,
+    -1814309216, 1148898640, -1821324572, 1137744621, -1828271356, 1126547765,
+    -1835149306, 1115308496, -1841958164, 1104027237, -1848697674, 1092704411,
+    -1855367581, 1081340445, -1861967634, 1069935768, -1868497586, 1058490808,
+    -1874957189, 1047005996, -1881346202, 1035481766, -1887664383, 1023918550,
+    -1893911494, 1012316784, -1900087301, 1000676905, -1906191570, 988999351,
+    -1912224073, 977284562, -1918184581, 965532978, -1924072871, 953745043,
+    -1929888720, 941921200, -1935631910, 930061894, -1941302225, 918167572,
+    -1946899451, 906238681, -1952423377, 894275671, -1957873796, 882278992,
+    -1963250501, 870249095, -1968553292, 858186435, -1973781967, 846091463,
+    -1978936331, 833964638, -1984016189, 821806413, -1989021350, 809617249,
+    -1993951625, 797397602, -1998806829, 785147934, -2003586779, 772868706,
+    -2008291295, 760560380, -2012920201, 748223418, -2017473321, 735858287,
+    -2021950484, 723465451, -2026351522, 711045377, -2030676269, 698598533,
+    -2034924562, 686125387, -2039096241, 673626408, -2043191150, 661102068,
+    -2047209133, 648552838, -2051150040, 635979190, -2055013723, 623381598,
+    -2058800036, 610760536, -2062508835, 598116479, -2066139983, 585449903,
+    -2069693342, 572761285, -2073168777, 560051104, -2076566160, 547319836,
+    -2079885360, 534567963, -2083126254, 521795963, -2086288720, 509004318,
+    -2089372638, 496193509, -2092377892, 483364019, -2095304370, 470516330,
+    -2098151960, 457650927, -2100920556, 444768294, -2103610054, 431868915,
+    -2106220352, 418953276, -2108751352, 406021865, -2111202959, 393075166,
+    -2113575080, 380113669, -2115867626, 367137861, -2118080511, 354148230,
+    -2120213651, 341145265, -2122266967, 328129457, -2124240380, 315101295,
+    -2126133817, 302061269, -2127947206, 289009871, -2129680480, 275947592,
+    -2131333572, 262874923, -2132906420, 249792358, -2134398966, 236700388,
+    -2135811153, 223599506, -2137142927, 210490206, -2138394240, 197372981,
+    -2139565043, 184248325, -2140655293, 171116733, -2141664948, 157978697,
+    -2142593971, 144834714, -2143442326, 131685278, -2144209982, 118530885,
+    -2144896910, 105372028, -2145503083, 92209205, -2146028480, 79042909,
+    -2146473080, 65873638, -2146836866, 52701887, -2147119825, 39528151,
+    -2147321946, 26352928, -2147443222, 13176712, (-2147483647 - 1), 0,
+    -2147443222, -13176712, -2147321946, -26352928, -2147119825, -39528151,
+    -2146836866, -52701887, -2146473080, -65873638, -2146028480, -79042909,
+    -2145503083, -92209205, -2144896910, -105372028, -2144209982, -118530885,
+    -2143442326, -131685278, -2142593971, -144834714, -2141664948, -157978697,
+    -2140655293, -171116733, -2139565043, -184248325, -2138394240, -197372981,
+    -2137142927, -210490206, -2135811153, -223599506, -2134398966, -236700388,
+    -2132906420, -249792358, -2131333572, -262874923, -2129680480, -275947592,
+    -2127947206, -289009871, -2126133817, -302061269, -2124240380, -315101295,
+    -2122266967, -328129457, -2120213651, -341145265, -2118080511, -354148230,
+    -2115867626, -367137861, -2113575080, -380113669, -2111202959, -393075166,
+    -2108751352, -406021865, -2106220352, -418953276, -2103610054, -431868915,
+    -2100920556, -444768294, -2098151960, -457650927, -2095304370, -470516330,
+    -2092377892, -483364019, -2089372638, -496193509, -2086288720, -509004318,
+    -2083126254, -521795963, -2079885360, -534567963, -2076566160, -547319836,
+    -2073168777, -560051104, -2069693342, -572761285, -2066139983, -585449903,
+    -2062508835, -598116479, -2058800036, -610760536, -2055013723, -623381598,
+    -2051150040, -635979190, -2047209133, -648552838, -2043191150, -661102068,
+    -2039096241, -673626408, -2034924562, -686125387, -2030676269, -698598533,
+    -2026351522, -711045377, -2021950484, -723465451, -2017473321, -735858287,
+    -2012920201, -748223418, -2008291295, -760560380, -2003586779, -772868706,
+    -1998806829, -785147934, -1993951625, -797397602, -1989021350, -809617249,
+    -1984016189, -821806413, -1978936331, -833964638, -1973781967, -846091463,
+    -1968553292, -858186435, -1963250501, -870249095, -1957873796, -882278992,
+    -1952423377, -894275671, -1946899451, -906238681, -1941302225, -918167572,
+    -1935631910, -930061894, -1929888720, -941921200, -1924072871, -953745043,
+    -1918184581, -965532978, -1912224073, -977284562, -1906191570, -988999351,
+    -1900087301, -1000676905, -1893911494, -1012316784, -1887664383, -1023918550,
+    -1881346202, -1035481766, -1874957189, -1047005996, -1868497586, -1058490808,
+    -1861967634, -1069935768, -1855367581, -1081340445, -1848697674, -1092704411,
+    -1841958164, -1104027237, -1835149306, -1115308496, -1828271356, -1126547765,
+    -1821324572, -1137744621, -1814309216, -1148898640, -1807225553, -1160009405,
+    -1800073849, -1171076495, -1792854372, -1182099496, -1785567396, -1193077991,
+    -1778213194, -1204011567, -1770792044, -1214899813, -1763304224, -1225742318,
+    -1755750017, -1236538675, -1748129707, -1247288478, -1740443581, -1257991320,
+    -1732691928, -1268646800, -1724875040, -1279254516, -1716993211, -1289814068,
+    -1709046739, -1300325060, -1701035922, -1310787095, -1692961062, -1321199781,
+    -1684822463, -1331562723, -1676620432, -1341875533, -1668355276, -1352137822,
+    -1660027308, -1362349204, -1651636841, -1372509294, -1643184191, -1382617710,
+    -1634669676, -1392674072, -1626093616, -1402678000, -1617456335, -1412629117,
+    -1608758157, -1422527051, -1599999411, -1432371426, -1591180426, -1442161874,
+    -1582301533, -1451898025, -1573363068, -1461579514, -1564365367, -1471205974,
+    -1555308768, -1480777044, -1546193612, -1490292364, -1537020244, -1499751576,
+    -1527789007, -1509154322, -1518500250, -1518500250, -1509154322, -1527789007,
+    -1499751576, -1537020244, -1490292364, -1546193612, -1480777044, -1555308768,
+    -1471205974, -1564365367, -1461579514, -1573363068, -1451898025, -1582301533,
+    -1442161874, -1591180426, -1432371426, -1599999411, -1422527051, -1608758157,
+    -1412629117, -1617456335, -1402678000, -1626093616, -1392674072, -1634669676,
+    -1382617710, -1643184191, -1372509294, -1651636841, -1362349204, -1660027308,
+    -1352137822, -1668355276, -1341875533, -1676620432, -1331562723, -1684822463,
+    -1321199781, -1692961062, -1310787095, -1701035922, -1300325060, -1709046739,
+    -1289814068, -1716993211, -1279254516, -1724875040, -1268646800, -1732691928,
+    -1257991320, -1740443581, -1247288478, -1748129707, -1236538675, -1755750017,
+    -1225742318, -1763304224, -1214899813, -1770792044, -1204011567, -1778213194,
+    -1193077991, -1785567396, -1182099496, -1792854372, -1171076495, -1800073849,
+    -1160009405, -1807225553, -1148898640, -1814309216, -1137744621, -1821324572,
+    -1126547765, -1828271356, -1115308496, -1835149306, -1104027237, -1841958164,
+    -1092704411, -1848697674, -1081340445, -1855367581, -1069935768, -1861967634,
+    -1058490808, -1868497586, -1047005996, -1874957189, -1035481766, -1881346202,
+    -1023918550, -1887664383, -1012316784, -1893911494, -1000676905, -1900087301,
+    -988999351, -1906191570, -977284562, -1912224073, -965532978, -1918184581,
+    -953745043, -1924072871, -941921200, -1929888720, -930061894, -1935631910,
+    -918167572, -1941302225, -906238681, -1946899451, -894275671, -1952423377,
+    -882278992, -1957873796, -870249095, -1963250501, -858186435, -1968553292,
+    -846091463, -1973781967, -833964638, -1978936331, -821806413, -1984016189,
+    -809617249, -1989021350, -797397602, -1993951625, -785147934, -1998806829,
+    -772868706, -2003586779, -760560380, -2008291295, -748223418, -2012920201,
+    -735858287, -2017473321, -723465451, -2021950484, -711045377, -2026351522,
+    -698598533, -2030676269, -686125387, -2034924562, -673626408, -2039096241,
+    -661102068, -2043191150, -648552838, -2047209133, -635979190, -2051150040,
+    -623381598, -2055013723, -610760536, -2058800036, -598116479, -2062508835,
+    -585449903, -2066139983, -572761285, -2069693342, -560051104, -2073168777,
+    -547319836, -2076566160, -534567963, -2079885360, -521795963, -2083126254,
+    -509004318, -2086288720, -496193509, -2089372638, -483364019, -2092377892,
+    -470516330, -2095304370, -457650927, -2098151960, -444768294, -2100920556,
+    -431868915, -2103610054, -418953276, -2106220352, -406021865, -2108751352,
+    -393075166, -2111202959, -380113669, -2113575080, -367137861, -2115867626,
+    -354148230, -2118080511, -341145265, -2120213651, -328129457, -2122266967,
+    -315101295, -2124240380, -302061269, -2126133817, -289009871, -2127947206,
+    -275947592, -2129680480, -262874923, -2131333572, -249792358, -2132906420,
+    -236700388, -2134398966, -223599506, -2135811153, -210490206, -2137142927,
+    -197372981, -2138394240, -184248325, -2139565043, -171116733, -2140655293,
+    -157978697, -2141664948, -144834714, -2142593971, -131685278, -2143442326,
+    -118530885, -2144209982, -105372028, -2144896910, -92209205, -2145503083,
+    -79042909, -2146028480, -65873638, -2146473080, -52701887, -2146836866,
+    -39528151, -2147119825, -26352928, -2147321946, -13176712, -2147443222,
+};
+
+/// cos, sin pairs, single precision
+const float fft_twiddle_f32[1536] = {
+    1.000000000e+00f, 0.000000000e+00f, 9.999811753e-01f, 6.135884649e-03f, 9.999247018e-01f, 1.227153829e-02f,
+    9.998305818e-01f, 1.840672991e-02f, 9.996988187e-01f, 2.454122852e-02f, 9.995294175e-01f, 3.067480318e-02f,
+    9.993223846e-01f, 3.680722294e-02f, 9.990777278e-01f, 4.293825693e-02f, 9.987954562e-01f, 4.906767433e-02f,
+    9.984755806e-01f, 5.519524435e-02f, 9.981181129e-01f, 6.132073630e-02f, 9.977230666e-01f, 6.744391956e-02f,
+    9.972904567e-01f, 7.356456360e-02f, 9.968202993e-01f, 7.968243797e-02f, 9.963126122e-01f, 8.579731234e-02f,
+    9.957674145e-01f, 9.190895650e-02f, 9.951847267e-01f, 9.801714033e-02f, 9.945645707e-01f, 1.041216339e-01f,
+    9.939069700e-01f, 1.102222073e-01f, 9.932119492e-01f, 1.163186309e-01f, 9.924795346e-01f, 1.224106752e-01f,
+    9.917097537e-01f, 1.284981108e-01f, 9.909026354e-01f, 1.345807085e-01f, 9.900582103e-01f, 1.406582393e-01f,
+    9.891765100e-01f, 1.467304745e-01f, 9.882575677e-01f, 1.527971853e-01f, 9.873014182e-01f, 1.588581433e-01f,
+    9.863080972e-01f, 1.649131205e-01f, 9.852776424e-01f, 1.709618888e-01f, 9.842100924e-01f, 1.770042204e-01f,
+    9.831054874e-01f, 1.830398880e-01f, 9.819638691e-01f, 1.890686641e-01f, 9.807852804e-01f, 1.950903220e-01f,
+    9.795697657e-01f, 2.011046348e-01f, 9.783173707e-01f, 2.071113762e-01f, 9.770281427e-01f, 2.131103199e-01f,
+    9.757021300e-01f, 2.191012402e-01f, 9.743393828e-01f, 2.250839114e-01f, 9.729399522e-01f, 2.310581083e-01f,
+    9.715038910e-01f, 2.370236060e-01f, 9.700312532e-01f, 2.429801799e-01f, 9.685220943e-01f, 2.489276057e-01f,
+    9.669764710e-01f, 2.548656596e-01f, 9.653944417e-01f, 2.607941179e-01f, 9.637760658e-01f, 2.667127575e-01f,
+    9.621214043e-01f, 2.726213554e-01f, 9.604305194e-01f, 2.785196894e-01f, 9.587034749e-01f, 2.844075372e-01f,
+    9.569403357e-01f, 2.902846773e-01f, 9.551411683e-01f, 2.961508882e-01f, 9.533060404e-01f, 3.020059493e-01f,
+    9.514350210e-01f, 3.078496400e-01f, 9.495281806e-01f, 3.136817404e-01f, 9.475855910e-01f, 3.195020308e-01f,
+    9.456073254e-01f, 3.253102922e-01f, 9.435934582e-01f, 3.311063058e-01f, 9.415440652e-01f, 3.368898534e-01f,
+    9.394592236e-01f, 3.426607173e-01f, 9.373390119e-01f, 3.484186802e-01f, 9.351835099e-01f, 3.541635254e-01f,
+    9.329927988e-01f, 3.598950365e-01f, 9.307669611e-01f, 3.656129978e-01f, 9.285060805e-01f, 3.713171940e-01f,
+    9.262102421e-01f, 3.770074102e-01f, 9.238795325e-01f, 3.826834324e-01f, 9.215140393e-01f, 3.883450467e-01f,
+    9.191138517e-01f, 3.939920401e-01f, 9.166790599e-01f, 3.996241998e-01f, 9.142097557e-01f, 4.052413140e-01f,
+    9.117060320e-01f, 4.108431711e-01f, 9.091679831e-01f, 4.164295601e-01f, 9.065957045e-01f, 4.220002708e-01f,
+    9.039892931e-01f, 4.275550934e-01f, 9.013488470e-01f, 4.330938189e-01f, 8.986744657e-01f, 4.386162385e-01f,
+    8.959662498e-01f, 4.441221446e-01f, 8.932243012e-01f, 4.496113297e-01f, 8.904487232e-01f, 4.550835871e-01f,
+    8.876396204e-01f, 4.605387110e-01f, 8.847970984e-01f, 4.659764958e-01f, 8.819212643e-01f, 4.713967368e-01f,
+    8.790122264e-01f, 4.767992301e-01f, 8.760700942e-01f, 4.821837721e-01f, 8.730949784e-01f, 4.875501601e-01f,
+    8.700869911e-01f, 4.928981922e-01f, 8.670462455e-01f, 4.982276670e-01f, 8.639728561e-01f, 5.035383837e-01f,
+    8.608669386e-01f, 5.088301425e-01f, 8.577286100e-01f, 5.141027442e-01f, 8.545579884e-01f, 5.193559902e-01f,
+    8.513551931e-01f, 5.245896827e-01f, 8.481203448e-01f, 5.298036247e-01f, 8.448535652e-01f, 5.349976199e-01f,
+    8.415549774e-01f, 5.401714727e-01f, 8.382247056e-01f, 5.453249884e-01f, 8.348628750e-01f, 5.504579729e-01f,
+    8.314696123e-01f, 5.555702330e-01f, 8.280450453e-01f, 5.606615762e-01f, 8.245893028e-01f, 5.657318108e-01f,
+    8.211025150e-01f, 5.707807459e-01f, 8.175848132e-01f, 5.758081914e-01f, 8.140363297e-01f, 5.808139581e-01f,
+    8.104571983e-01f, 5.857978575e-01f, 8.068475535e-01f, 5.907597019e-01f, 8.032075315e-01f, 5.956993045e-01f,
+    7.995372691e-01f, 6.006164794e-01f, 7.958369046e-01f, 6.055110414e-01f, 7.921065773e-01f, 6.103828063e-01f,
+    7.883464276e-01f, 6.152315906e-01f, 7.845565972e-01f, 6.200572118e-01f, 7.807372286e-01f, 6.248594881e-01f,
+    7.768884657e-01f, 6.296382389e-01f, 7.730104534e-01f, 6.343932842e-01f, 7.691033376e-01f, 6.391244449e-01f,
+    7.651672656e-01f, 6.438315429e-01f, 7.612023855e-01f, 6.485144010e-01f, 7.572088465e-01f, 6.531728430e-01f,
+    7.531867990e-01f, 6.578066933e-01f, 7.491363945e-01f, 6.624157776e-01f, 7.450577854e-01f, 6.669999223e-01f,
+    7.409511254e-01f, 6.715589548e-01f, 7.368165689e-01f, 6.760927036e-01f, 7.326542717e-01f, 6.806009978e-01f,
+    7.284643904e-01f, 6.850836678e-01f, 7.242470830e-01f, 6.895405447e-01f, 7.200025080e-01f, 6.939714609e-01f,
+    7.157308253e-01f, 6.983762494e-01f, 7.114321957e-01f, 7.027547445e-01f, 7.071067812e-01f, 7.071067812e-01f,
+    7.027547445e-01f, 7.114321957e-01f, 6.983762494e-01f, 7.157308253e-01f, 6.939714609e-01f, 7.200025080e-01f,
+    6.895405447e-01f, 7.242470830e-01f, 6.850836678e-01f, 7.284643904e-01f, 6.806009978e-01f, 7.326542717e-01f,
+    6.760927036e-01f, 7.368165689e-01f, 6.715589548e-01f, 7.409511254e-01f, 6.669999223e-01f, 7.450577854e-01f,
+    6.624157776e-01f, 7.491363945e-01f, 6.578066933e-01f, 7.531867990e-01f, 6.531728430e-01f, 7.572088465e-01f,
+    6.485144010e-01f, 7.612023855e-01f, 6.438315429e-01f, 7.651672656e-01f, 6.391244449e-01f, 7.691033376e-01f,
+    6.343932842e-01f, 7.730104534e-01f, 6.296382389e-01f, 7.768884657e-01f, 6.248594881e-01f, 7.807372286e-01f,
+    6.200572118e-01f, 7.845565972e-01f, 6.152315906e-01f, 7.883464276e-01f, 6.103828063e-01f, 7.921065773e-01f,
+    6.055110414e-01f, 7.958369046e-01f, 6.006164794e-01f, 7.995372691e-01f, 5.956993045e-01f, 8.032075315e-01f,
+    5.907597019e-01f, 8.068475535e-01f, 5.857978575e-01f, 8.104571983e-01f, 5.808139581e-01f, 8.140363297e-01f,
+    5.758081914e-01f, 8.175848132e-01f, 5.707807459e-01f, 8.211025150e-01f, 5.657318108e-01f, 8.245893028e-01f,
+    5.606615762e-01f, 8.280450453e-01f, 5.555702330e-01f, 8.314696123e-01f, 5.504579729e-01f, 8.348628750e-01f,
+    5.453249884e-01f, 8.382247056e-01f, 5.401714727e-01f, 8.415549774e-01f, 5.349976199e-01f, 8.448535652e-01f,
+    5.298036247e-01f, 8.481203448e-01f, 5.245896827e-01f, 8.513551931e-01f, 5.193559902e-01f, 8.545579884e-01f,
+    5.141027442e-01f, 8.577286100e-01f, 5.088301425e-01f, 8.608669386e-01f, 5.035383837e-01f, 8.639728561e-01f,
+    4.982276670e-01f, 8.670462455e-01f, 4.928981922e-01f, 8.700869911e-01f, 4.875501601e-01f, 8.730949784e-01f,
+    4.821837721e-01f, 8.760700942e-01f, 4.767992301e-01f, 8.790122264e-01f, 4.713967368e-01f, 8.819212643e-01f,
+    4.659764958e-01f, 8.847970984e-01f, 4.605387110e-01f, 8.876396204e-01f, 4.550835871e-01f, 8.904487232e-01f,
+    4.496113297e-01f, 8.932243012e-01f, 4.441221446e-01f, 8.959662498e-01f, 4.386162385e-01f, 8.986744657e-01f,
+    4.330938189e-01f, 9.013488470e-01f, 4.275550934e-01f, 9.039892931e-01f, 4.220002708e-01f, 9.065957045e-01f,
+    4.164295601e-01f, 9.091679831e-01f, 4.108431711e-01f, 9.117060320e-01f, 4.052413140e-01f, 9.142097557e-01f,
+    3.996241998e-01f, 9.166790599e-01f, 3.939920401e-01f, 9.191138517e-01f, 3.883450467e-01f, 9.215140393e-01f,
+    3.826834324e-01f, 9.238795325e-01f, 3.770074102e-01f, 9.262102421e-01f, 3.713171940e-01f, 9.285060805e-01f,
+    3.656129978e-01f, 9.307669611e-01f, 3.598950365e-01f, 9.329927988e-01f, 3.541635254e-01f, 9.351835099e-01f,
+    3.484186802e-01f, 9.373390119e-01f, 3.426607173e-01f, 9.394592236e-01f, 3.368898534e-01f, 9.415440652e-01f,
+    3.311063058e-01f, 9.435934582e-01f, 3.253102922e-01f, 9.456073254e-01f, 3.195020308e-01f, 9.475855910e-01f,
+    3.136817404e-01f, 9.495281806e-01f, 3.078496400e-01f, 9.514350210e-01f, 3.020059493e-01f, 9.533060404e-01f,
+    2.961508882e-01f, 9.551411683e-01f, 2.902846773e-01f, 9.569403357e-01f, 2.844075372e-01f, 9.587034749e-01f,
+    2.785196894e-01f, 9.604305194e-01f, 2.726213554e-01f, 9.621214043e-01f, 2.667127575e-01f, 9.637760658e-01f,
+    2.607941179e-01f, 9.653944417e-01f, 2.548656596e-01f, 9.669764710e-01f, 2.489276057e-01f, 9.685220943e-01f,
+    2.429801799e-01f, 9.700312532e-01f, 2.370236060e-01f, 9.715038910e-01f, 2.310581083e-01f, 9.729399522e-01f,
+    2.250839114e-01f, 9.743393828e-01f, 2.191012402e-01f, 9.757021300e-01f, 2.131103199e-01f, 9.770281427e-01f,
+    2.071113762e-01f, 9.783173707e-01f, 2.011046348e-01f, 9.795697657e-01f, 1.950903220e-01f, 9.807852804e-01f,
+    1.890686641e-01f, 9.819638691e-01f, 1.830398880e-01f, 9.831054874e-01f, 1.770042204e-01f, 9.842100924e-01f,
+    1.709618888e-01f, 9.852776424e-01f, 1.649131205e-01f, 9.863080972e-01f, 1.588581433e-01f, 9.873014182e-01f,
+    1.527971853e-01f, 9.882575677e-01f, 1.467304745e-01f, 9.891765100e-01f, 1.406582393e-01f, 9.900582103e-01f,
+    1.345807085e-01f, 9.909026354e-01f, 1.284981108e-01f, 9.917097537e-01f, 1.224106752e-01f, 9.924795346e-01f,
+    1.163186309e-01f, 9.932119492e-01f, 1.102222073e-01f, 9.939069700e-01f, 1.041216339e-01f, 9.945645707e-01f,
+    9.801714033e-02f, 9.951847267e-01f, 9.190895650e-02f, 9.957674145e-01f, 8.579731234e-02f, 9.963126122e-01f,
+    7.968243797e-02f, 9.968202993e-01f, 7.356456360e-02f, 9.972904567e-01f, 6.744391956e-02f, 9.977230666e-01f,
+    6.132073630e-02f, 9.981181129e-01f, 5.519524435e-02f, 9.984755806e-01f, 4.906767433e-02f, 9.987954562e-01f,
+    4.293825693e-02f, 9.990777278e-01f, 3.680722294e-02f, 9.993223846e-01f, 3.067480318e-02f, 9.995294175e-01f,
+    2.454122852e-02f, 9.996988187e-01f, 1.840672991e-02f, 9.998305818e-01f, 1.227153829e-02f, 9.999247018e-01f,
+    6.135884649e-03f, 9.999811753e-01f, 6.123233996e-17f, 1.000000000e+00f, -6.135884649e-03f, 9.999811753e-01f,
+    -1.227153829e-02f, 9.999247018e-01f, -1.840672991e-02f, 9.998305818e-01f, -2.454122852e-02f, 9.996988187e-01f,
+    -3.067480318e-02f, 9.995294175e-01f, -3.680722294e-02f, 9.993223846e-01f, -4.293825693e-02f, 9.990777278e-01f,
+    -4.906767433e-02f, 9.987954562e-01f, -5.519524435e-02f, 9.984755806e-01f, -6.132073630e-02f, 9.981181129e-01f,
+    -6.744391956e-02f, 9.977230666e-01f, -7.356456360e-02f, 9.972904567e-01f, -7.968243797e-02f, 9.968202993e-01f,
+    -8.579731234e-02f, 9.963126122e-01f, -9.190895650e-02f, 9.957674145e-01f, -9.801714033e-02f, 9.951847267e-01f,
+    -1.041216339e-01f, 9.945645707e-01f, -1.102222073e-01f, 9.939069700e-01f, -1.163186309e-01f, 9.932119492e-01f,
+    -1.224106752e-01f, 9.924795346e-01f, -1.284981108e-01f, 9.917097537e-01f, -1.345807085e-01f, 9.909026354e-01f,
+    -1.406582393e-01f, 9.900582103e-01f, -1.467304745e-01f, 9.891765100e-01f, -1.527971853e-01f, 9.882575677e-01f,
+    -1.588581433e-01f, 9.873014182e-01f, -1.649131205e-01f, 9.863080972e-01f, -1.709618888e-01f, 9.852776424e-01f,
+    -1.770042204e-01f, 9.842100924e-01f, -1.830398880e-01f, 9.831054874e-01f, -1.890686641e-01f, 9.819638691e-01f,
+    -1.950903220e-01f, 9.807852804e-01f, -2.011046348e-01f, 9.795697657e-01f, -2.071113762e-01f, 9.783173707e-01f,
+    -2.131103199e-01f, 9.770281427e-01f, -2.191012402e-01f, 9.757021300e-01f, -2.250839114e-01f, 9.743393828e-01f,
+    -2.310581083e-01f, 9.729399522e-01f, -2.370236060e-01f, 9.715038910e-01f, -2.429801799e-01f, 9.700312532e-01f,
+    -2.489276057e-01f, 9.685220943e-01f, -2.548656596e-01f, 9.669764710e-01f, -2.607941179e-01f, 9.653944417e-01f,
+    -2.667127575e-01f, 9.637760658e-01f, -2.726213554e-01f, 9.621214043e-01f, -2.785196894e-01f, 9.604305194e-01f,
+    -2.844075372e-01f, 9.587034749e-01f, -2.902846773e-01f, 9.569403357e-01f, -2.961508882e-01f, 9.551411683e-01f,
+    -3.020059493e-01f, 9.533060404e-01f, -3.078496400e-01f, 9.514350210e-01f, -3.136817404e-01f, 9.495281806e-01f,
+    -3.195020308e-01f, 9.475855910e-01f, -3.253102922e-01f, 9.456073254e-01f, -3.311063058e-01f, 9.435934582e-01f,
+    -3.368898534e-01f, 9.415440652e-01f, -3.426607173e-01f, 9.394592236e-01f, -3.484186802e-01f, 9.373390119e-01f,
+    -3.541635254e-01f, 9.351835099e-01f, -3.598950365e-01f, 9.329927988e-01f, -3.656129978e-01f, 9.307669611e-01f,
+    -3.713171940e-01f, 9.285060805e-01f, -3.770074102e-01f, 9.262102421e-01f, -3.826834324e-01f, 9.238795325e-01f,
+    -3.883450467e-01f, 9.215140393e-01f, -3.939920401e-01f, 9.191138517e-01f, -3.996241998e-01f, 9.166790599e-01f,
+    -4.052413140e-01f, 9.142097557e-01f, -4.108431711e-01f, 9.117060320e-01f, -4.164295601e-01f, 9.091679831e-01f,
+    -4.220002708e-01f, 9.065957045e-01f, -4.275550934e-01f, 9.039892931e-01f, -4.330938189e-01f, 9.013488470e-01f,
+    -4.386162385e-01f, 8.986744657e-01f, -4.441221446e-01f, 8.959662498e-01f, -4.496113297e-01f, 8.932243012e-01f,
+    -4.550835871e-01f, 8.904487232e-01f, -4.605387110e-01f, 8.876396204e-01f, -4.659764958e-01f, 8.847970984e-01f,
+    -4.713967368e-01f, 8.819212643e-01f, -4.767992301e-01f, 8.790122264e-01f, -4.821837721e-01f, 8.760700942e-01f,
+    -4.875501601e-01f, 8.730949784e-01f, -4.928981922e-01f, 8.700869911e-01f, -4.982276670e-01f, 8.670462455e-01f,
+    -5.035383837e-01f, 8.639728561e-01f, -5.088301425e-01f, 8.608669386e-01f, -5.141027442e-01f, 8.577286100e-01f,
+    -5.193559902e-01f, 8.545579884e-01f, -5.245896827e-01f, 8.513551931e-01f, -5.298036247e-01f, 8.481203448e-01f,
+    -5.349976199e-01f, 8.448535652e-01f, -5.401714727e-01f, 8.415549774e-01f, -5.453249884e-01f, 8.382247056e-01f,
+    -5.504579729e-01f, 8.348628750e-01f, -5.555702330e-01f, 8.314696123e-01f, -5.606615762e-01f, 8.280450453e-01f,
+    -5.657318108e-01f, 8.245893028e-01f, -5.707807459e-01f, 8.211025150e-01f, -5.758081914e-01f, 8.175848132e-01f,
+    -5.808139581e-01f, 8.140363297e-01f, -5.857978575e-01f, 8.104571983e-01f, -5.907597019e-01f, 8.068475535e-01f,
+    -5.956993045e-01f, 8.032075315e-01f, -6.006164794e-01f, 7.995372691e-01f, -6.055110414e-01f, 7.958369046e-01f,
+    -6.103828063e-01f, 7.921065773e-01f, -6.152315906e-01f, 7.883464276e-01f, -6.200572118e-01f, 7.845565972e-01f,
+    -6.248594881e-01f, 7.807372286e-01f, -6.296382389e-01f, 7.768884657e-01f, -6.343932842e-01f, 7.730104534e-01f,
+    -6.391244449e-01f, 7.691033376e-01f, -6.438315429e-01f, 7.651672656e-01f, -6.485144010e-01f, 7.612023855e-01f,
+    -6.531728430e-01f, 7.572088465e-01f, -6.578066933e-01f, 7.531867990e-01f, -6.624157776e-01f, 7.491363945e-01f,
+    -6.669999223e-01f, 7.450577854e-01f, -6.715589548e-01f, 7.409511254e-01f, -6.760927036e-01f, 7.368165689e-01f,
+    -6.806009978e-01f, 7.326542717e-01f, -6.850836678e-01f, 7.284643904e-01f, -6.895405447e-01f, 7.242470830e-01f,
+    -6.939714609e-01f, 7.200025080e-01f, -6.983762494e-01f, 7.157308253e-01f, -7.027547445e-01f, 7.114321957e-01f,
+    -7.071067812e-01f, 7.071067812e-01f, -7.114321957e-01f, 7.027547445e-01f, -7.157308253e-01f, 6.983762494e-01f,
+    -7.200025080e-01f, 6.939714609e-01f, -7.242470830e-01f, 6.895405447e-01f, -7.284643904e-01f, 6.850836678e-01f,
+    -7.326542717e-01f, 6.806009978e-01f, -7.368165689e-01f, 6.760927036e-01f, -7.409511254e-01f, 6.715589548e-01f,
+    -7.450577854e-01f, 6.669999223e-01f, -7.491363945e-01f, 6.624157776e-01f, -7.531867990e-01f, 6.578066933e-01f,
+    -7.572088465e-01f, 6.531728430e-01f, -7.612023855e-01f, 6.485144010e-01f, -7.651672656e-01f, 6.438315429e-01f,
+    -7.691033376e-01f, 6.391244449e-01f, -7.730104534e-01f, 6.343932842e-01f, -7.768884657e-01f, 6.296382389e-01f,
+    -7.807372286e-01f, 6.248594881e-01f, -7.845565972e-01f, 6.200572118e-01f, -7.883464276e-01f, 6.152315906e-01f,
+    -7.921065773e-01f, 6.103828063e-01f, -7.958369046e-01f, 6.055110414e-01f, -7.995372691e-01f, 6.006164794e-01f,
+    -8.032075315e-01f, 5.956993045e-01f, -8.068475535e-01f, 5.907597019e-01f, -8.104571983e-01f, 5.857978575e-01f,
+    -8.140363297e-01f, 5.808139581e-01f, -8.175848132e-01f, 5.758081914e-01f, -8.211025150e-01f, 5.707807459e-01f,
+    -8.245893028e-01f, 5.657318108e-01f, -8.280450453e-01f, 5.606615762e-01f, -8.314696123e-01f, 5.555702330e-01f,
+    -8.348628750e-01f, 5.504579729e-01f, -8.382247056e-01f, 5.453249884e-01f, -8.415549774e-01f, 5.401714727e-01f,
+    -8.448535652e-01f, 5.349976199e-01f, -8.481203448e-01f, 5.298036247e-01f, -8.513551931e-01f, 5.245896827e-01f,
+    -8.545579884e-01f, 5.193559902e-01f, -8.577286100e-01f, 5.141027442e-01f, -8.608669386e-01f, 5.088301425e-01f,
+    -8.639728561e-01f, 5.035383837e-01f, -8.670462455e-01f, 4.982276670e-01f, -8.700869911e-01f, 4.928981922e-01f,
+    -8.730949784e-01f, 4.875501601e-01f, -8.760700942e-01f, 4.821837721e-01f, -8.790122264e-01f, 4.767992301e-01f,
+    -8.819212643e-01f, 4.713967368e-01f, -8.847970984e-01f, 4.659764958e-01f, -8.876396204e-01f, 4.605387110e-01f,
+    -8.904487232e-01f, 4.550835871e-01f, -8.932243012e-01f, 4.496113297e-01f, -8.959662498e-01f, 4.441221446e-01f,
+    -8.986744657e-01f, 4.386162385e-01f, -9.013488470e-01f, 4.330938189e-01f, -9.039892931e-01f, 4.275550934e-01f,
+    -9.065957045e-01f, 4.220002708e-01f, -9.091679831e-01f, 4.164295601e-01f, -9.117060320e-01f, 4.108431711e-01f,
+    -9.142097557e-01f, 4.052413140e-01f, -9.166790599e-01f, 3.996241998e-01f, -9.191138517e-01f, 3.939920401e-01f,
+    -9.215140393e-01f, 3.883450467e-01f, -9.238795325e-01f, 3.826834324e-01f, -9.262102421e-01f, 3.770074102e-01f,
+    -9.285060805e-01f, 3.713171940e-01f, -9.307669611e-01f, 3.656129978e-01f, -9.329927988e-01f, 3.598950365e-01f,
+    -9.351835099e-01f, 3.541635254e-01f, -9.373390119e-01f, 3.484186802e-01f, -9.394592236e-01f, 3.426607173e-01f,
+    -9.415440652e-01f, 3.368898534e-01f, -9.435934582e-01f, 3.311063058e-01f, -9.456073254e-01f, 3.253102922e-01f,
+    -9.475855910e-01f, 3.195020308e-01f, -9.495281806e-01f, 3.136817404e-01f, -9.514350210e-01f, 3.078496400e-01f,
+    -9.533060404e-01f, 3.020059493e-01f, -9.551411683e-01f, 2.961508882e-01f, -9.569403357e-01f, 2.902846773e-01f,
+    -9.587034749e-01f, 2.844075372e-01f, -9.604305194e-01f, 2.785196894e-01f, -9.621214043e-01f, 2.726213554e-01f,
+    -9.637760658e-01f, 2.667127575e-01f, -9.653944417e-01f, 2.607941179e-01f, -9.669764710e-01f, 2.548656596e-01f,
+    -9.685220943e-01f, 2.489276057e-01f, -9.700312532e-01f, 2.429801799e-01f, -9.715038910e-01f, 2.370236060e-01f,
+    -9.729399522e-01f, 2.310581083e-01f, -9.743393828e-01f, 2.250839114e-01f, -9.757021300e-01f, 2.191012402e-01f,
+    -9.770281427e-01f, 2.131103199e-01f, -9.783173707e-01f, 2.071113762e-01f, -9.795697657e-01f, 2.011046348e-01f,
+    -9.807852804e-01f, 1.950903220e-01f, -9.819638691e-01f, 1.890686641e-01f, -9.831054874e-01f, 1.830398880e-01f,
+    -9.842100924e-01f, 1.770042204e-01f, -9.852776424e-01f, 1.709618888e-01f, -9.863080972e-01f, 1.649131205e-01f,
+    -9.873014182e-01f, 1.588581433e-01f, -9.882575677e-01f, 1.527971853e-01f, -9.891765100e-01f, 1.467304745e-01f,
+    -9.900582103e-01f, 1.406582393e-01f, -9.909026354e-01f, 1.345807085e-01f, -9.917097537e-01f, 1.284981108e-01f,
+    -9.924795346e-01f, 1.224106752e-01f, -9.932119492e-01f, 1.163186309e-01f, -9.939069700e-01f, 1.102222073e-01f,
+    -9.945645707e-01f, 1.041216339e-01f, -9.951847267e-01f, 9.801714033e-02f, -9.957674145e-01f, 9.190895650e-02f,
+    -9.963126122e-01f, 8.579731234e-02f, -9.968202993e-01f, 7.968243797e-02f, -9.972904567e-01f, 7.356456360e-02f,
+    -9.977230666e-01f, 6.744391956e-02f, -9.981181129e-01f, 6.132073630e-02f, -9.984755806e-01f, 5.519524435e-02f,
+    -9.987954562e-01f, 4.906767433e-02f, -9.990777278e-01f, 4.293825693e-02f, -9.993223846e-01f, 3.680722294e-02f,
+    -9.995294175e-01f, 3.067480318e-02f, -9.996988187e-01f, 2.454122852e-02f, -9.998305818e-01f, 1.840672991e-02f,
+    -9.999247018e-01f, 1.227153829e-02f, -9.999811753e-01f, 6.135884649e-03f, -1.000000000e+00f, 1.224646799e-16f,
+    -9.999811753e-01f, -6.135884649e-03f, -9.999247018e-01f, -1.227153829e-02f, -9.998305818e-01f, -1.840672991e-02f,
+    -9.996988187e-01f, -2.454122852e-02f, -9.995294175e-01f, -3.067480318e-02f, -9.993223846e-01f, -3.680722294e-02f,
+    -9.990777278e-01f, -4.293825693e-02f, -9.987954562e-01f, -4.906767433e-02f, -9.984755806e-01f, -5.519524435e-02f,
+    -9.981181129e-01f, -6.132073630e-02f, -9.977230666e-01f, -6.744391956e-02f, -9.972904567e-01f, -7.356456360e-02f,
+    -9.968202993e-01f, -7.968243797e-02f, -9.963126122e-01f, -8.579731234e-02f, -9.957674145e-01f, -9.190895650e-02f,
+    -9.951847267e-01f, -9.801714033e-02f, -9.945645707e-01f, -1.041216339e-01f, -9.939069700e-01f, -1.102222073e-01f,
+    -9.932119492e-01f, -1.163186309e-01f, -9.924795346e-01f, -1.224106752e-01f, -9.917097537e-01f, -1.284981108e-01f,
+    -9.909026354e-01f, -1.345807085e-01f, -9.900582103e-01f, -1.406582393e-01f, -9.891765100e-01f, -1.467304745e-01f,
+    -9.882575677e-01f, -1.527971853e-01f, -9.873014182e-01f, -1.588581433e-01f, -9.863080972e-01f, -1.649131205e-01f,
+    -9.852776424e-01f, -1.709618888e-01f, -9.842100924e-01f, -1.770042204e-01f, -9.831054874e-01f, -1.830398880e-01f,
+    -9.819638691e-01f, -1.890686641e-01f, -9.807852804e-01f, -1.950903220e-01f, -9.795697657e-01f, -2.011046348e-01f,
+    -9.783173707e-01f, -2.071113762e-01f, -9.770281427e-01f, -2.131103199e-01f, -9.757021300e-01f, -2.191012402e-01f,
+    -9.743393828e-01f, -2.250839114e-01f, -9.729399522e-01f, -2.310581083e-01f, -9.715038910e-01f, -2.370236060e-01f,
+    -9.700312532e-01f, -2.429801799e-01f, -9.685220943e-01f, -2.489276057e-01f, -9.669764710e-01f, -2.548656596e-01f,
+    -9.653944417e-01f, -2.607941179e-01f, -9.637760658e-01f, -2.667127575e-01f, -9.621214043e-01f, -2.726213554e-01f,
+    -9.604305194e-01f, -2.785196894e-01f, -9.587034749e-01f, -2.844075372e-01f, -9.569403357e-01f, -2.902846773e-01f,
+    -9.551411683e-01f, -2.961508882e-01f, -9.533060404e-01f, -3.020059493e-01f, -9.514350210e-01f, -3.078496400e-01f,
+    -9.495281806e-01f, -3.136817404e-01f, -9.475855910e-01f, -3.195020308e-01f, -9.456073254e-01f, -3.253102922e-01f,
+    -9.435934582e-01f, -3.311063058e-01f, -9.415440652e-01f, -3.368898534e-01f, -9.394592236e-01f, -3.426607173e-01f,
+    -9.373390119e-01f, -3.484186802e-01f, -9.351835099e-01f, -3.541635254e-01f, -9.329927988e-01f, -3.598950365e-01f,
+    -9.307669611e-01f, -3.656129978e-01f, -9.285060805e-01f, -3.713171940e-01f, -9.262102421e-01f, -3.770074102e-01f,
+    -9.238795325e-01f, -3.826834324e-01f, -9.215140393e-01f, -3.883450467e-01f, -9.191138517e-01f, -3.939920401e-01f,
+    -9.166790599e-01f, -3.996241998e-01f, -9.142097557e-01f, -4.052413140e-01f, -9.117060320e-01f, -4.108431711e-01f,
+    -9.091679831e-01f, -4.164295601e-01f, -9.065957045e-01f, -4.220002708e-01f, -9.039892931e-01f, -4.275550934e-01f,
+    -9.013488470e-01f, -4.330938189e-01f, -8.986744657e-01f, -4.386162385e-01f, -8.959662498e-01f, -4.441221446e-01f,
+    -8.932243012e-01f, -4.496113297e-01f, -8.904487232e-01f, -4.550835871e-01f, -8.876396204e-01f, -4.605387110e-01f,
+    -8.847970984e-01f, -4.659764958e-01f, -8.819212643e-01f, -4.713967368e-01f, -8.790122264e-01f, -4.767992301e-01f,
+    -8.760700942e-01f, -4.821837721e-01f, -8.730949784e-01f, -4.875501601e-01f, -8.700869911e-01f, -4.928981922e-01f,
+    -8.670462455e-01f, -4.982276670e-01f, -8.639728561e-01f, -5.035383837e-01f, -8.608669386e-01f, -5.088301425e-01f,
+    -8.577286100e-01f, -5.141027442e-01f, -8.545579884e-01f, -5.193559902e-01f, -8.513551931e-01f, -5.245896827e-01f,
+    -8.481203448e-01f, -5.298036247e-01f, -8.448535652e-01f, -5.349976199e-01f, -8.415549774e-01f, -5.401714727e-01f,
+    -8.382247056e-01f, -5.453249884e-01f, -8.348628750e-01f, -5.504579729e-01f, -8.314696123e-01f, -5.555702330e-01f,
+    -8.280450453e-01f, -5.606615762e-01f, -8.245893028e-01f, -5.657318108e-01f, -8.211025150e-01f, -5.707807459e-01f,
+    -8.175848132e-01f, -5.758081914e-01f, -8.140363297e-01f, -5.808139581e-01f, -8.104571983e-01f, -5.857978575e-01f,
+    -8.068475535e-01f, -5.907597019e-01f, -8.032075315e-01f, -5.956993045e-01f, -7.995372691e-01f, -6.006164794e-01f,
+    -7.958369046e-01f, -6.055110414e-01f, -7.921065773e-01f, -6.103828063e-01f, -7.883464276e-01f, -6.152315906e-01f,
+    -7.845565972e-01f, -6.200572118e-01f, -7.807372286e-01f, -6.248594881e-01f, -7.768884657e-01f, -6.296382389e-01f,
+    -7.730104534e-01f, -6.343932842e-01f, -7.691033376e-01f, -6.391244449e-01f, -7.651672656e-01f, -6.438315429e-01f,
+    -7.612023855e-01f, -6.485144010e-01f, -7.572088465e-01f, -6.531728430e-01f, -7.531867990e-01f, -6.578066933e-01f,
+    -7.491363945e-01f, -6.624157776e-01f, -7.450577854e-01f, -6.669999223e-01f, -7.409511254e-01f, -6.715589548e-01f,
+    -7.368165689e-01f, -6.760927036e-01f, -7.326542717e-01f, -6.806009978e-01f, -7.284643904e-01f, -6.850836678e-01f,
+    -7.242470830e-01f, -6.895405447e-01f, -7.200025080e-01f, -6.939714609e-01f, -7.157308253e-01f, -6.983762494e-01f,
+    -7.114321957e-01f, -7.027547445e-01f, -7.071067812e-01f, -7.071067812e-01f, -7.027547445e-01f, -7.114321957e-01f,
+    -6.983762494e-01f, -7.157308253e-01f, -6.939714609e-01f, -7.200025080e-01f, -6.895405447e-01f, -7.242470830e-01f,
+    -6.850836678e-01f, -7.284643904e-01f, -6.806009978e-01f, -7.326542717e-01f, -6.760927036e-01f, -7.368165689e-01f,
+    -6.715589548e-01f, -7.409511254e-01f, -6.669999223e-01f, -7.450577854e-01f, -6.624157776e-01f, -7.491363945e-01f,
+    -6.578066933e-01f, -7.531867990e-01f, -6.531728430e-01f, -7.572088465e-01f, -6.485144010e-01f, -7.612023855e-01f,
+    -6.438315429e-01f, -7.651672656e-01f, -6.391244449e-01f, -7.691033376e-01f, -6.343932842e-01f, -7.730104534e-01f,
+    -6.296382389e-01f, -7.768884657e-01f, -6.248594881e-01f, -7.807372286e-01f, -6.200572118e-01f, -7.845565972e-01f,
+    -6.152315906e-01f, -7.883464276e-01f, -6.103828063e-01f, -7.921065773e-01f, -6.055110414e-01f, -7.958369046e-01f,
+    -6.006164794e-01f, -7.995372691e-01f, -5.956993045e-01f, -8.032075315e-01f, -5.907597019e-01f, -8.068475535e-01f,
+    -5.857978575e-01f, -8.104571983e-01f, -5.808139581e-01f, -8.140363297e-01f, -5.758081914e-01f, -8.175848132e-01f,
+    -5.707807459e-01f, -8.211025150e-01f, -5.657318108e-01f, -8.245893028e-01f, -5.606615762e-01f, -8.280450453e-01f,
+    -5.555702330e-01f, -8.314696123e-01f, -5.504579729e-01f, -8.348628750e-01f, -5.453249884e-01f, -8.382247056e-01f,
+    -5.401714727e-01f, -8.415549774e-01f, -5.349976199e-01f, -8.448535652e-01f, -5.298036247e-01f, -8.481203448e-01f,
+    -5.245896827e-01f, -8.513551931e-01f, -5.193559902e-01f, -8.545579884e-01f, -5.141027442e-01f, -8.577286100e-01f,
+    -5.088301425e-01f, -8.608669386e-01f, -5.035383837e-01f, -8.639728561e-01f, -4.982276670e-01f, -8.670462455e-01f,
+    -4.928981922e-01f, -8.700869911e-01f, -4.875501601e-01f, -8.730949784e-01f, -4.821837721e-01f, -8.760700942e-01f,
+    -4.767992301e-01f, -8.790122264e-01f, -4.713967368e-01f, -8.819212643e-01f, -4.659764958e-01f, -8.847970984e-01f,
+    -4.605387110e-01f, -8.876396204e-01f, -4.550835871e-01f, -8.904487232e-01f, -4.496113297e-01f, -8.932243012e-01f,
+    -4.441221446e-01f, -8.959662498e-01f, -4.386162385e-01f, -8.986744657e-01f, -4.330938189e-01f, -9.013488470e-01f,
+    -4.275550934e-01f, -9.039892931e-01f, -4.220002708e-01f, -9.065957045e-01f, -4.164295601e-01f, -9.091679831e-01f,
+    -4.108431711e-01f, -9.117060320e-01f, -4.052413140e-01f, -9.142097557e-01f, -3.996241998e-01f, -9.166790599e-01f,
+    -3.939920401e-01f, -9.191138517e-01f, -3.883450467e-01f, -9.215140393e-01f, -3.826834324e-01f, -9.238795325e-01f,
+    -3.770074102e-01f, -9.262102421e-01f, -3.713171940e-01f, -9.285060805e-01f, -3.656129978e-01f, -9.307669611e-01f,
+    -3.598950365e-01f, -9.329927988e-01f, -3.541635254e-01f, -9.351835099e-01f, -3.484186802e-01f, -9.373390119e-01f,
+    -3.426607173e-01f, -9.394592236e-01f, -3.368898534e-01f, -9.415440652e-01f, -3.311063058e-01f, -9.435934582e-01f,
+    -3.253102922e-01f, -9.456073254e-01f, -3.195020308e-01f, -9.475855910e-01f, -3.136817404e-01f, -9.495281806e-01f,
+    -3.078496400e-01f, -9.514350210e-01f, -3.020059493e-01f, -9.533060404e-01f, -2.961508882e-01f, -9.551411683e-01f,
+    -2.902846773e-01f, -9.569403357e-01f, -2.844075372e-01f, -9.587034749e-01f, -2.785196894e-01f, -9.604305194e-01f,
+    -2.726213554e-01f, -9.621214043e-01f, -2.667127575e-01f, -9.637760658e-01f, -2.607941179e-01f, -9.653944417e-01f,
+    -2.548656596e-01f, -9.669764710e-01f, -2.489276057e-01f, -9.685220943e-01f, -2.429801799e-01f, -9.700312532e-01f,
+    -2.370236060e-01f, -9.715038910e-01f, -2.310581083e-01f, -9.729399522e-01f, -2.250839114e-01f, -9.743393828e-01f,
+    -2.191012402e-01f, -9.757021300e-01f, -2.131103199e-01f, -9.770281427e-01f, -2.071113762e-01f, -9.783173707e-01f,
+    -2.011046348e-01f, -9.795697657e-01f, -1.950903220e-01f, -9.807852804e-01f, -1.890686641e-01f, -9.819638691e-01f,
+    -1.830398880e-01f, -9.831054874e-01f, -1.770042204e-01f, -9.842100924e-01f, -1.709618888e-01f, -9.852776424e-01f,
+    -1.649131205e-01f, -9.863080972e-01f, -1.588581433e-01f, -9.873014182e-01f, -1.527971853e-01f, -9.882575677e-01f,
+    -1.467304745e-01f, -9.891765100e-01f, -1.406582393e-01f, -9.900582103e-01f, -1.345807085e-01f, -9.909026354e-01f,
+    -1.284981108e-01f, -9.917097537e-01f, -1.224106752e-01f, -9.924795346e-01f, -1.163186309e-01f, -9.932119492e-01f,
+    -1.102222073e-01f, -9.939069700e-01f, -1.041216339e-01f, -9.945645707e-01f, -9.801714033e-02f, -9.951847267e-01f,
+    -9.190895650e-02f, -9.957674145e-01f, -8.579731234e-02f, -9.963126122e-01f, -7.968243797e-02f, -9.968202993e-01f,
+    -7.356456360e-02f, -9.972904567e-01f, -6.744391956e-02f, -9.977230666e-01f, -6.132073630e-02f, -9.981181129e-01f,
+    -5.519524435e-02f, -9.984755806e-01f, -4.906767433e-02f, -9.987954562e-01f, -4.293825693e-02f, -9.990777278e-01f,
+    -3.680722294e-02f, -9.993223846e-01f, -3.067480318e-02f, -9.995294175e-01f, -2.454122852e-02f, -9.996988187e-01f,
+    -1.840672991e-02f, -9.998305818e-01f, -1.227153829e-02f, -9.999247018e-01f, -6.135884649e-03f, -9.999811753e-01f,
+};
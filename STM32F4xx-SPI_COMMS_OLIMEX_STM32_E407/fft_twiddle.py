@@ -0,0 +1,92 @@
+#!/usr/bin/env python
+# Generates fft_twiddle.c, the FFT twiddle tables kept in flash
+#
+#   python fft_twiddle.py > fft_twiddle.c
+#
+# Entry m holds cos(2*pi*m/N) and sin(2*pi*m/N) for N = FFT_MAX_POINTS, m = 0 .. 3N/4 - 1,
+# which covers every radix-4 stage of every FFT size up to N and the real FFT split.
+# Smaller FFTs step through the table with a stride of FFT_MAX_POINTS / n.
+#
+# Q15 entries are packed as one word per entry, cos in the low half and sin in the high
+# half, so a complex sample word (re low, im high) is rotated with SMUAD/SMUSDX. Q31 and
+# single precision float entries are cos, sin pairs.
+
+import math
+
+FFT_MAX_POINTS = 1024
+ENTRIES = 3 * FFT_MAX_POINTS // 4
+
+
+def q(v, bits):
+    full = 1 << (bits - 1)
+    return max(-full, min(full - 1, int(round(v * full))))
+
+
+def c_int(v):
+    # INT32_MIN has no decimal literal of type int
+    return '(-2147483647 - 1)' if v == -(1 << 31) else '%d' % v
+
+
+def main():
+    out = []
+    out.append('/// @file fft_twiddle.c')
+    out.append('/// @brief FFT twiddle tables, generated by fft_twiddle.py - do not edit')
+    out.append('///')
+    out.append('/// @author Peter Ludlow')
+    out.append('')
+    out.append('#include <stdint.h>')
+    out.append('#include "fft.h"')
+    out.append('')
+    out.append('#if FFT_MAX_POINTS != %d' % FFT_MAX_POINTS)
+    out.append('#error "fft_twiddle.c out of date, regenerate with fft_twiddle.py"')
+    out.append('#endif')
+    out.append('')
+
+    out.append('/// cos | sin << 16, Q15')
+    out.append('const uint32_t fft_twiddle_q15[%d] = {' % ENTRIES)
+    row = []
+    for m in range(ENTRIES):
+        a = 2.0 * math.pi * m / FFT_MAX_POINTS
+        c = q(math.cos(a), 16) & 0xFFFF
+        s = q(math.sin(a), 16) & 0xFFFF
+        row.append('0x%08X' % ((s << 16) | c))
+        if len(row) == 6:
+            out.append('    ' + ', '.join(row) + ',')
+            row = []
+    if row:
+        out.append('    ' + ', '.join(row) + ',')
+    out.append('};')
+    out.append('')
+
+    out.append('/// cos, sin pairs, Q31')
+    out.append('const int32_t fft_twiddle_q31[%d] = {' % (2 * ENTRIES))
+    row = []
+    for m in range(ENTRIES):
+        a = 2.0 * math.pi * m / FFT_MAX_POINTS
+        row.append('%s, %s' % (c_int(q(math.cos(a), 32)), c_int(q(math.sin(a), 32))))
+        if len(row) == 3:
+            out.append('    ' + ', '.join(row) + ',')
+            row = []
+    if row:
+        out.append('    ' + ', '.join(row) + ',')
+    out.append('};')
+    out.append('')
+
+    out.append('/// cos, sin pairs, single precision')
+    out.append('const float fft_twiddle_f32[%d] = {' % (2 * ENTRIES))
+    row = []
+    for m in range(ENTRIES):
+        a = 2.0 * math.pi * m / FFT_MAX_POINTS
+        row.append('%.9ef, %.9ef' % (math.cos(a), math.sin(a)))
+        if len(row) == 3:
+            out.append('    ' + ', '.join(row) + ',')
+            row = []
+    if row:
+        out.append('    ' + ', '.join(row) + ',')
+    out.append('};')
+
+    print('\n'.join(out))
+
+
+if __name__ == '__main__':
+    main()
@@ -14,3 +14,75 @@
 #define MINOR_VERSION      1
 /// Revision version - changes when bugs are fixed, code is restructured, etc.
 #define REVISION_VERSION   1
+
+/// @name Build options
+/// Optional firmware features, can be overridden from the Makefile UDEFS
+
+/// Runs the SPI bus time benchmark after the front end setup
+#if !defined(SPI_BUS_BENCHMARK)
+#define SPI_BUS_BENCHMARK  FALSE
+#endif
+
+/// Runs the FFT kernel cycle count benchmark after the front end setup, results on USART6
+#if !defined(FFT_BENCHMARK)
+#define FFT_BENCHMARK      FALSE
+#endif
+
+/// Runs the range-Doppler frame cycle count benchmark after the front end setup, results on USART6
+#if !defined(RD_BENCHMARK)
+#define RD_BENCHMARK       FALSE
+#endif
+
+/// Runs the decimation cycle count benchmark after the front end setup, results on USART6
+#if !defined(DECIM_BENCHMARK)
+#define DECIM_BENCHMARK    FALSE
+#endif
+
+/// Runs the chirp preprocessing cycle count benchmark after the front end setup, results on USART6
+#if !defined(PREPROC_BENCHMARK)
+#define PREPROC_BENCHMARK  FALSE
+#endif
+
+/// Runs the capture and range-Doppler processing for CAPTURE_BENCH_MS after the front end setup, capture statistics
+/// and throughput on USART6 - with ADC_CAPTURE_SIMULATOR the sample generator stands in for the AD9648
+#if !defined(CAPTURE_BENCHMARK)
+#define CAPTURE_BENCHMARK  FALSE
+#endif
+
+/// Fast boot - minimum supply settle, boot to first chirp checked against FAST_BOOT_BUDGET_MS at runtime
+#if !defined(FAST_BOOT)
+#define FAST_BOOT          FALSE
+#endif
+
+/// Fast boot budget, from the start of main() to the first ADF4159 ramp complete edge (mS). The cycle counter
+/// starts in timing_probe_init(), the reset and the __early_init clock and PLL start-up are not included
+#if !defined(FAST_BOOT_BUDGET_MS)
+#define FAST_BOOT_BUDGET_MS  50
+#endif
+
+/// Supply settle time before the front end is programmed (mS). The ADF4159, ADF4355 and ADA8282 only need
+/// their supplies in range before the first SPI write, none of them specifies a wait of its own; the fast
+/// boot 1 mS is a margin for the front end regulators to ramp, not a data sheet figure - check it with a
+/// scope on the supply rails when the board or its regulators change
+#if !defined(FRONT_END_POWER_UP_MS)
+#if FAST_BOOT
+#define FRONT_END_POWER_UP_MS  1
+#else
+#define FRONT_END_POWER_UP_MS  10
+#endif
+#endif
+
+/// Records phase timing probes and prints them over USART6 after the front end setup
+#if !defined(TIMING_PROBES)
+#define TIMING_PROBES      TRUE
+#endif
+
+/// Replaces the DCMI sample capture by the synthetic sample generator of adc_capture_sim.c (no board needed)
+#if !defined(ADC_CAPTURE_SIMULATOR)
+#define ADC_CAPTURE_SIMULATOR  FALSE
+#endif
+
+/// AD9648 encode clock of the board = sample pairs per second (Hz), for the capture and the AD9648 setup
+#if !defined(AD9648_ENCODE_HZ)
+#define AD9648_ENCODE_HZ   10000000UL
+#endif
@@ -0,0 +1,33 @@
+/// @file host/ch.h
+/// @brief Host stand-in for the ChibiOS/RT header, for the host reference builds only
+///
+/// Provides the few kernel types and OSAL calls used by the modules built on a PC. There
+/// is one thread and no interrupts: the mock back end of the reference tool runs the
+/// DMA completion callbacks itself from osalThreadSuspendS().
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <assert.h>
+
+typedef int32_t msg_t;
+typedef void   *thread_reference_t;
+
+#define MSG_OK                  ((msg_t)0)
+
+#define osalDbgCheck(c)         assert(c)
+#define osalDbgAssert(c, r)     assert((c) && (r))
+#define osalSysLock()           ((void)0)
+#define osalSysUnlock()         ((void)0)
+#define osalSysLockFromISR()    ((void)0)
+#define osalSysUnlockFromISR()  ((void)0)
+
+/*
+ * Function declarations, implemented by the reference tool
+ */
+msg_t osalThreadSuspendS(thread_reference_t *trp);
+void osalThreadResumeI(thread_reference_t *trp, msg_t msg);
@@ -0,0 +1,30 @@
+/// @file host/hal.h
+/// @brief Host stand-in for the ChibiOS/HAL header, for the host reference builds only
+///
+/// Declares the SPI driver subset used by the register sequence engine. The I-class
+/// calls are implemented by the mock back end of the reference tool.
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+
+typedef struct SPIDriver SPIDriver;
+typedef void (*spicallback_t)(SPIDriver *spip);
+
+typedef struct {
+    spicallback_t end_cb;   ///< Transfer complete callback
+} SPIConfig;
+
+struct SPIDriver {
+    const SPIConfig *config;
+};
+
+/*
+ * Function declarations, implemented by the reference tool
+ */
+void spiSelectI(SPIDriver *spip);
+void spiUnselectI(SPIDriver *spip);
+void spiStartSendI(SPIDriver *spip, size_t n, const void *txbuf);
+void spiStartExchangeI(SPIDriver *spip, size_t n, const void *txbuf, void *rxbuf);
@@ -0,0 +1,91 @@
+/// @file hw_delay.c
+/// @brief Hardware timed delays on a dedicated GPT timer
+///
+/// The system tick runs at CH_CFG_ST_FREQUENCY = 10 kHz, so chThdSleep() cannot wait
+/// less than 100 uS and rounds every wait up to the next tick. Settle times of the
+/// synthesizer sequences are tens to hundreds of microseconds, so they are timed by a
+/// one-shot of a dedicated basic timer instead: the calling thread is suspended and
+/// resumed from the timer interrupt, the CPU stays free for other threads. Waits too
+/// short to be worth a thread switch are busy waited on the DWT cycle counter.
+///
+/// Every delay is at least the requested time, rounded up to the next timer count.
+///
+/// @author Peter Ludlow
+
+#include "ch.h"
+#include "hal.h"
+#include "hw_delay.h"
+
+static thread_reference_t waiter;
+static mutex_t delay_mtx;
+
+
+/*
+ *@brief  One-shot end callback, called from the timer ISR
+ */
+
+static void hw_delay_cb(GPTDriver *gptp){
+
+    (void)gptp;
+
+    osalSysLockFromISR();
+    osalThreadResumeI(&waiter, MSG_OK);
+    osalSysUnlockFromISR();
+}
+
+static const GPTConfig hw_delay_cfg = {
+    HW_DELAY_FREQUENCY,
+    hw_delay_cb,
+    0,
+    0
+};
+
+
+/*
+ *@brief  Starts the delay timer, must be called once after chSysInit()
+ */
+
+void hw_delay_init(void){
+
+    chMtxObjectInit(&delay_mtx);
+    gptStart(&HW_DELAY_GPT, &hw_delay_cfg);
+}
+
+/*
+ *@brief  Blocks the calling thread for at least ns nanoseconds
+ *@note   Thread context only, threads needing the timer at the same time are serialized
+ */
+
+void hw_delay_ns(uint32_t ns){
+
+    uint64_t ticks;
+    gptcnt_t shot;
+
+    if (ns < HW_DELAY_POLL_NS) {
+        chSysPolledDelayX((rtcnt_t)(((uint64_t)STM32_HCLK * ns + 999999999U) / 1000000000U));
+        return;
+    }
+
+    ticks = ((uint64_t)HW_DELAY_FREQUENCY * ns + 999999999U) / 1000000000U;
+
+    chMtxLock(&delay_mtx);
+    while (ticks > 0U) {
+        shot = (gptcnt_t)((ticks > HW_DELAY_MAX_TICKS) ? HW_DELAY_MAX_TICKS : ticks);
+        ticks -= shot;
+
+        osalSysLock();
+        gptStartOneShotI(&HW_DELAY_GPT, shot);
+        (void) osalThreadSuspendS(&waiter);
+        osalSysUnlock();
+    }
+    chMtxUnlock(&delay_mtx);
+}
+
+/*
+ *@brief  Blocks the calling thread for at least us microseconds
+ */
+
+void hw_delay_us(uint32_t us){
+
+    hw_delay_ns(us * 1000U);
+}
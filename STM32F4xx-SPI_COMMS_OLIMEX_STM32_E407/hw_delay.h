@@ -0,0 +1,34 @@
+/// @file hw_delay.h
+/// @brief Variable/Function Declarations - Hardware timed delays on a dedicated GPT timer
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+#include "hal.h"
+
+/// GPT driver of the delay service, TIM7 (APB1 timer clock 84 MHz)
+#if !defined(HW_DELAY_GPT)
+#define HW_DELAY_GPT            GPTD7
+#endif
+
+/// Delay timer count frequency, must divide the timer clock - 84 MHz / 4 = 21 MHz, 47.6 nS resolution
+#if !defined(HW_DELAY_FREQUENCY)
+#define HW_DELAY_FREQUENCY      (STM32_TIMCLK1 / 4U)
+#endif
+
+/// Delays below this are busy waited, a thread switch would cost more than the wait (nS)
+#if !defined(HW_DELAY_POLL_NS)
+#define HW_DELAY_POLL_NS        2000U
+#endif
+
+/// Longest one-shot period of the 16-bit counter, longer delays are chained
+#define HW_DELAY_MAX_TICKS      0xFFFFU
+
+/*
+ * Function declarations
+ */
+void hw_delay_init(void);
+void hw_delay_ns(uint32_t ns);
+void hw_delay_us(uint32_t us);
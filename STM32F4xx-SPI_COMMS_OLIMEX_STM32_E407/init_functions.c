@@ -8,36 +8,24 @@
 #include "ch.h"
 #include "hal.h"
 #include "global.h"
-
-
-/*===============================================================*/
-/*Configuration Structures                                       */
-/*===============================================================*/
-
-/**
- *@brief  SPI Configuration
- *@note   SPI configuration for SPI1
- */
-
-// fVCOCLK = (fPLL_CLK_IP x PLLN/PLLM)/PLLP = (12 MHz x 336/12)/2 = 168 MHz
-
-/*
- * SPI configuration (SPI Speed = fVCO_CLK/4/128 = 328.125kHz, CPHA=1 [2ND CLK transition is the 1st data capture edge], CPOL=1 [CLK to 1 when idle], MSB first).
-*/
-
-static const SPIConfig hs_spicfg = {
-        NULL,
-        GPIOA,
-        GPIOA_SPI1_NSS,
-        SPI_CR1_BR_2 | SPI_CR1_BR_1 | SPI_CR1_CPOL | SPI_CR1_CPHA
-};
+#include "spi_device.h"
+#include "spi_queue.h"
+#include "reg_verify.h"
+#include "spi_sequence.h"
+#include "adf4355_freq.h"
+#include "adf4159_chirp.h"
+#include "lock_detect.h"
+#include "boot_seq.h"
+#include "hw_delay.h"
+#include "timing_probe.h"
+#include "chprintf.h"
 
 
 /*
  * ADF4159 Frequency Synthesizer Register Values
  */
 
-static uint8_t ADF4159_power_on_register_values_buf[11][4] = {
+static const uint8_t ADF4159_power_on_register_values_buf[11][4] = {
 {0x00,0x00,0x00,0x07}, // Write to ADF4159 register 7
 {0x00,0x00,0x3E,0x86}, // Write to ADF4159 register 6 [with STEP SEL = 0]
 {0x00,0x80,0x3E,0x86}, // Write to ADF4159 register 6 [with STEP SEL = 1]
@@ -51,7 +39,7 @@ static uint8_t ADF4159_power_on_register_values_buf[11][4] = {
 {0xB0,0x36,0x60,0x00}, // Write to ADF4159 register 0
 };
 
-static uint8_t ADF4159_register_values_buf[8][4] = {
+static const uint8_t ADF4159_register_values_buf[8][4] = {
 {0x00,0x00,0x00,0x07}, // Write to ADF4159 register 7
 {0x00,0x00,0x3E,0x86}, // Write to ADF4159 register 6
 {0x00,0x12,0x8F,0x75}, // Write to ADF4159 register 5
@@ -69,8 +57,8 @@ static uint8_t ADF4159_register_values_buf[8][4] = {
 {0x00,0x00,0x00,0x01}, // Write to ADF4159 register 1
 
 
-//{0xB0,0x36,0x40,0x00}, // Write to ADF4159 register 0 // 21.65-22.65 GHz FMCW Ramp enabled, MUXOUT = Digital Lock Detect
-//{0xF8,0x36,0x40,0x00}, // Write to ADF4159 register 0 // 21.65-22.65 GHz FMCW Ramp enabled, MUXOUT = Ramp Complete
+//{0xB0,0x36,0x40,0x00}, // Write to ADF4159 register 0 // 21.70-22.70 GHz FMCW Ramp enabled, MUXOUT = Digital Lock Detect
+//{0xF8,0x36,0x40,0x00}, // Write to ADF4159 register 0 // 21.70-22.70 GHz FMCW Ramp enabled, MUXOUT = Ramp Complete
 
 //{0xB0,0x36,0x60,0x00}, // Write to ADF4159 register 0 // 21.75-22.75 GHz FMCW Ramp enabled, MUXOUT = Digital Lock Detect
 //{0xF8,0x36,0x60,0x00}, // Write to ADF4159 register 0 // 21.75-22.75 GHz FMCW Ramp enabled, MUXOUT = Ramp Complete
@@ -90,14 +78,14 @@ static uint8_t ADF4159_register_values_buf[8][4] = {
 //{0xB0,0x38,0x00,0x00}, // Write to ADF4159 register 0 // 22.4-23.4 GHz FMCW Ramp enabled, MUXOUT = Digital Lock Detect
 //{0xF8,0x38,0x00,0x00}, // Write to ADF4159 register 0 // 22.4-23.4 GHz FMCW Ramp enabled, MUXOUT = Ramp Complete
 
-//{0x30,0x36,0x40,0x00}, // Write to ADF4159 register 0 // 21.65 GHz frequency, FMCW Ramp disabled, MUXOUT = Digital Lock Detect
+//{0x30,0x36,0x40,0x00}, // Write to ADF4159 register 0 // 21.70 GHz frequency, FMCW Ramp disabled, MUXOUT = Digital Lock Detect
 
 {0x30,0x36,0x60,0x00}, // Write to ADF4159 register 0 // 21.75 GHz frequency, FMCW Ramp disabled, MUXOUT = Digital Lock Detect
 //{0x08,0x36,0x60,0x00}, // Write to ADF4159 register 0 // 21.75 GHz frequency, FMCW Ramp disabled, MUXOUT = DVDD
 //{0x18,0x36,0x60,0x00}, // Write to ADF4159 register 0 // 21.75 GHz frequency, FMCW Ramp disabled, MUXOUT = R DIVIDER OUTPUT
 
 
-//{0x30,0x38,0xC0,0x00}, // Write to ADF4159 register 0 // 22.65 GHz frequency, FMCW Ramp disabled, MUXOUT = Digital Lock Detect
+//{0x30,0x38,0xC0,0x00}, // Write to ADF4159 register 0 // 22.70 GHz frequency, FMCW Ramp disabled, MUXOUT = Digital Lock Detect
 //{0x30,0x38,0xE0,0x00}, // Write to ADF4159 register 0 // 22.75 GHz frequency, FMCW Ramp disabled, MUXOUT = Digital Lock Detect
 
 };
@@ -106,7 +94,7 @@ static uint8_t ADF4159_register_values_buf[8][4] = {
  * ADF4355 Frequency Synthesizer Register Values
  */
 
-static uint8_t ADF4355_power_on_register_values_buf1[12][4] = {
+static const uint8_t ADF4355_power_on_register_values_buf1[12][4] = {
 {0x00,0x01,0x04,0x1C}, // Write to ADF4355 register 12
 {0x00,0x61,0x30,0x0B}, // Write to ADF4355 register 11
 {0x00,0xC0,0x3E,0xBA}, // Write to ADF4355 register 10
@@ -131,7 +119,7 @@ static uint8_t ADF4355_power_on_register_values_buf1[12][4] = {
 
 };
 
-static uint8_t ADF4355_power_on_register_values_buf2[5][4] = {
+static const uint8_t ADF4355_power_on_register_values_buf2[5][4] = {
 //{0x00,0x20,0x06,0x40}, // Write to ADF4355 register 0 [For halved fPFD] // IF frequency = 5.0 GHz
 {0x00,0x20,0x06,0xC0}, // Write to ADF4355 register 0 [For halved fPFD] // IF frequency = 5.4 GHz /5.402 GHz
 {0x30,0x00,0x89,0x84}, // Write to ADF4355 register 4 [R divider output set to output desired fPFD]
@@ -152,7 +140,7 @@ static uint8_t ADF4355_power_on_register_values_buf2[5][4] = {
  * ADA8282 Quad-Channel Low Noise Amplifier/Variable Gain Amplifier Register Values
  */
 
-static uint8_t ADA8282_U404_power_on_register_values[7][3] = {
+static const uint8_t ADA8282_U404_power_on_register_values[7][3] = {
 {0x00,0x00,0x00}, // Write to ADA8282 register 0x00 [INTF_CONFA]
 {0x00,0x10,0x20}, // Write to ADA8282 register 0x10 [LNA_OFFSET0]
 {0x00,0x11,0x20}, // Write to ADA8282 register 0x11 [LNA_OFFSET1]
@@ -163,7 +151,7 @@ static uint8_t ADA8282_U404_power_on_register_values[7][3] = {
 {0x00,0x18,0x00}, // Write to ADA8282 register 0x18 [EN_BIAS_GEN]
 };
 
-static uint8_t ADA8282_U405_power_on_register_values[7][3] = {
+static const uint8_t ADA8282_U405_power_on_register_values[7][3] = {
 {0x00,0x00,0x00}, // Write to ADA8282 register 0x00 [INTF_CONFA]
 {0x00,0x10,0x20}, // Write to ADA8282 register 0x10 [LNA_OFFSET0]
 {0x00,0x11,0x20}, // Write to ADA8282 register 0x11 [LNA_OFFSET1]
@@ -174,43 +162,32 @@ static uint8_t ADA8282_U405_power_on_register_values[7][3] = {
 {0x00,0x18,0x00}, // Write to ADA8282 register 0x18 [EN_BIAS_GEN]
 };
 
-static uint8_t ADA8282_U404_power_on_register_values_readback[7][3] = {
-{0x80,0x00,0x00}, // Write to ADA8282 register 0x00 [INTF_CONFA]
-{0x80,0x10,0x20}, // Write to ADA8282 register 0x10 [LNA_OFFSET0]
-{0x80,0x11,0x20}, // Write to ADA8282 register 0x11 [LNA_OFFSET1]
-{0x80,0x14,0x00}, // Write to ADA8282 register 0x14 [BIAS_SEL]
-//{0x00,0x15,0x00}, // Write to ADA8282 register 0x15 [PGA_GAIN] (minimum gain)
-{0x80,0x15,0xFF}, // Write to ADA8282 register 0x15 [PGA_GAIN] (maximum gain)
-{0x80,0x17,0x07}, // Write to ADA8282 register 0x17 [EN_CHAN]
-{0x80,0x18,0x00}, // Write to ADA8282 register 0x18 [EN_BIAS_GEN]
-};
-
-static uint8_t AD9648_init1[6][3] = {
+static const uint8_t AD9648_init1[4][3] = {
 {0x00, 0x05, 0x03}, /* Select both ADC channels */
 {0x00, 0xFF, 0x01}, /* Transfer bit */
 {0x00, 0x08, 0x03}, /* Digital reset of the ADC chip */
 {0x00, 0xFF, 0x01}, /* Transfer bit */
 };
 
-static uint8_t AD9648_init2[2][3] = {
+static const uint8_t AD9648_init2[2][3] = {
 {0x00, 0x08, 0x00}, /* Normal operation of the ADC chip */
 {0x00, 0xFF, 0x01}, /* Transfer bit */
 };
 
-static uint8_t AD9648_init3[4][3] = {
+static const uint8_t AD9648_init3[4][3] = {
 {0x00, 0x00, 0x3C}, /* Soft Reset */
 {0x00, 0xFF, 0x01}, /* Transfer bit */
 {0x00, 0x04, 0x00}, /* Device index B */
 {0x00, 0x05, 0x01}, /* Device index A */
 };
 
-static uint8_t AD9648_write[1][3] = {
+static const uint8_t AD9648_write[1][3] = {
 {0x00, 0x0D, 0x02}, /* Test mode */
 //{0x00, 0xFF, 0x01}, /* Transfer bit */
 };
 
 
-static uint8_t AD9648_read[2][3] = {
+static const uint8_t AD9648_read[2][3] = {
 //{0x00, 0x04, 0x00}, /* Device index B */
 //{0x00, 0x05, 0x01}, /* Device index A */
 {0x80, 0x01, 0x00}, /* Chip ID */
@@ -223,114 +200,118 @@ static uint8_t AD9648_read[2][3] = {
 
 
 /*
- *@brief  ADF4159 register setup - set operating frequency, FMCW sweep characteristics
+ * Register sequences - descriptor lists played out by the SPI sequence engine
  */
 
-void AD9648_init(void){
-
-    int i;
-
-    /*
-     * Program AD9648 with desired register values
-     */
+static const spi_sequence_t AD9648_init1_seq[] = {
+        SPI_SEQUENCE(AD9648_init1)
+};
 
-    spiAcquireBus(&SPID1);
-    spiStart(&SPID1, &hs_spicfg);
+static const spi_sequence_t AD9648_init2_seq[] = {
+        SPI_SEQUENCE(AD9648_init2)
+};
 
-    // Configure AD9648 registers
-    for(i = 0; i < 4; i++){
-        spiSelect(&SPID1);
-        spiSend(&SPID1,3,AD9648_init1[i]);
-        spiUnselect(&SPID1);
-    }
+static const spi_sequence_t AD9648_init3_seq[] = {
+        SPI_SEQUENCE(AD9648_init3)
+};
 
-    //chThdSleepMilliseconds(200);
-    spiStop(&SPID1);
-    spiReleaseBus(&SPID1);
+static const spi_sequence_t AD9648_write_seq[] = {
+        SPI_SEQUENCE(AD9648_write)
+};
 
-    chThdSleepMilliseconds(1000);
+static const spi_sequence_t AD9648_read_seq[] = {
+        SPI_SEQUENCE(AD9648_read)
+};
 
+static const spi_sequence_t ADF4159_seq[] = {
+        SPI_SEQUENCE(ADF4159_power_on_register_values_buf),
+        SPI_SEQUENCE(ADF4159_register_values_buf)
+};
 
-    spiAcquireBus(&SPID1);
-    spiStart(&SPID1, &hs_spicfg);
+static const spi_sequence_t ADA8282_U404_seq[] = {
+        SPI_SEQUENCE(ADA8282_U404_power_on_register_values)
+};
 
-    // Configure AD9648 registers
-    for(i = 0; i < 2; i++){
-        spiSelect(&SPID1);
-        spiSend(&SPID1,3,AD9648_init2[i]);
-        spiUnselect(&SPID1);
-    }
+static const spi_sequence_t ADA8282_U405_seq[] = {
+        SPI_SEQUENCE(ADA8282_U405_power_on_register_values)
+};
 
-    //chThdSleepMilliseconds(200);
-    spiStop(&SPID1);
-    spiReleaseBus(&SPID1);
+#define SEQ_LEN(seq)    ((uint8_t)(sizeof(seq) / sizeof((seq)[0])))
 
-    chThdSleepMilliseconds(1000);
+/// ADF4355 PFD frequency of the power-on tables, 100 MHz reference with R = 1
+#define ADF4355_FPFD_HZ         100000000UL
 
+/// AD9648 wait after the digital and the soft reset writes (mS). No data sheet figure for the reset
+/// completion is cited here, so this stays a conservative millisecond wait, 100000 encode clock cycles
+/// at the 10 MHz AD9648_ENCODE_HZ, rather than a cycle count - replace it when a figure is cited
+#if !defined(AD9648_RESET_WAIT_MS)
+#define AD9648_RESET_WAIT_MS        10U
+#endif
 
-    spiAcquireBus(&SPID1);
-    spiStart(&SPID1, &hs_spicfg);
+/// ADF4159 ramp start at the end of the boot - R0 ramp enable and MUXOUT, R4 ramp status
+#define ADF4159_R0_RAMP_ON          (1UL << 31)
+#define ADF4159_R0_MUXOUT_MASK      (0xFUL << 27)
+#define ADF4159_R4_STATUS_MASK      (0x1FUL << 21)
+#define ADF4159_R4_RAMP_COMPLETE    (3UL << 21)
 
-    // Configure AD9648 registers
-    for(i = 0; i < 4; i++){
-        spiSelect(&SPID1);
-        spiSend(&SPID1,3,AD9648_init3[i]);
-        spiUnselect(&SPID1);
-    }
+/// Wait for the first ramp complete edge after the ramp start (mS), several slopes of the 1 mS power-on ramp
+#if !defined(ADF4159_FIRST_RAMP_TIMEOUT_MS)
+#define ADF4159_FIRST_RAMP_TIMEOUT_MS   10U
+#endif
 
-    //chThdSleepMilliseconds(200);
-    spiStop(&SPID1);
-    spiReleaseBus(&SPID1);
+/// Number of complete programming rounds averaged by SPI_bus_benchmark()
+#define SPI_BENCHMARK_ROUNDS    16
 
-    chThdSleepMilliseconds(1000);
 
-}
+/*
+ *@brief  AD9648 register setup - channel selection, digital reset and soft reset
+ */
 
-void AD9648_write_func(void){
+void AD9648_init(void){
 
-    int i;
+    PROBE_BEGIN("AD9648_init");
 
     /*
      * Program AD9648 with desired register values
      */
 
-    spiAcquireBus(&SPID1);
-    spiStart(&SPID1, &hs_spicfg);
+    spi_device_send(SPI_AD9648, AD9648_init1_seq, SEQ_LEN(AD9648_init1_seq));
+    reg_cache_sync(&AD9648_regs, &AD9648_init1[0][0], 4);
 
-    // Configure AD9648 registers
-    for(i = 0; i < 1; i++){
-        spiSelect(&SPID1);
-        spiSend(&SPID1,3,AD9648_write[i]);
-        spiUnselect(&SPID1);
-    }
+    chThdSleepMilliseconds(AD9648_RESET_WAIT_MS);
 
-    //chThdSleepMilliseconds(200);
-    spiStop(&SPID1);
-    spiReleaseBus(&SPID1);
+    spi_device_send(SPI_AD9648, AD9648_init2_seq, SEQ_LEN(AD9648_init2_seq));
+    reg_cache_sync(&AD9648_regs, &AD9648_init2[0][0], 2);
 
-}
+    chThdSleepMilliseconds(AD9648_RESET_WAIT_MS);
 
-void AD9648_read_func(void){
+    spi_device_send(SPI_AD9648, AD9648_init3_seq, SEQ_LEN(AD9648_init3_seq));
+    reg_cache_invalidate(&AD9648_regs);     // Soft reset returns every register to its default
+    reg_cache_sync(&AD9648_regs, &AD9648_init3[0][0], 4);
 
-    int i;
+    chThdSleepMilliseconds(AD9648_RESET_WAIT_MS);
+
+    PROBE_END("AD9648_init");
+}
+
+void AD9648_write_func(void){
 
     /*
      * Program AD9648 with desired register values
      */
 
-    spiAcquireBus(&SPID1);
-    spiStart(&SPID1, &hs_spicfg);
+    spi_device_send(SPI_AD9648, AD9648_write_seq, SEQ_LEN(AD9648_write_seq));
+    reg_cache_sync(&AD9648_regs, &AD9648_write[0][0], 1);
 
-    // Configure AD9648 registers
-    for(i = 0; i < 2; i++){
-        spiSelect(&SPID1);
-        spiSend(&SPID1,3,AD9648_read[i]);
-        spiUnselect(&SPID1);
-    }
+}
 
-    //chThdSleepMilliseconds(200);
-    spiStop(&SPID1);
-    spiReleaseBus(&SPID1);
+void AD9648_read_func(void){
+
+    /*
+     * Program AD9648 with desired register values
+     */
+
+    spi_device_send(SPI_AD9648, AD9648_read_seq, SEQ_LEN(AD9648_read_seq));
 
 }
 
@@ -340,140 +321,437 @@ void AD9648_read_func(void){
 
 void ADF4159_init(void){
 
-    int i;
+    PROBE_BEGIN("ADF4159_init");
 
     /*
-     * Program ADF4159 with power-on register values, i.e. load registers from 7-0, load registers 6/5/4 twice
+     * Program ADF4159 with power-on register values, i.e. load registers from 7-0, load registers 6/5/4 twice,
+     * followed directly by the desired register values
      */
 
-    //Select multiplexed line for ADF4159
-    palClearPad(GPIOG, GPIOG_SPI_NSS_S0);
-    palClearPad(GPIOG, GPIOG_SPI_NSS_S1);
+    lock_detect_arm(LOCK_ADF4159);
+    spi_device_send(SPI_ADF4159, ADF4159_seq, SEQ_LEN(ADF4159_seq));
+
+    reg_cache_sync(&ADF4159_regs, &ADF4159_power_on_register_values_buf[0][0], 11);
+    reg_cache_sync(&ADF4159_regs, &ADF4159_register_values_buf[0][0], 8);
+
+    PROBE_END("ADF4159_init");
+}
+
+/*
+ *@brief  Programs an FMCW chirp compiled at runtime
+ *@note   Only the registers differing from the device are written, in datasheet order. On an unprogrammed
+ *        device every register is dirty, so this also performs the complete power-on load. Returns false,
+ *        without touching the device, when the chirp cannot be synthesized
+ */
 
-    spiAcquireBus(&SPID1);
-    spiStart(&SPID1, &hs_spicfg);
+bool ADF4159_set_chirp(const adf4159_chirp_t *chirp){
+
+    adf4159_chirp_plan_t plan;
+    uint8_t i;
+
+    if (!adf4159_chirp_compile(chirp, ADF4159_REF_HZ, ADF4159_R_DIV, &plan)) {
+        return false;
+    }
 
-    // Configure ADF4159 registers
-    for(i = 0; i < 11; i++){
-        spiSelect(&SPID1);
-        spiSend(&SPID1,4,ADF4159_power_on_register_values_buf[i]);
-        spiUnselect(&SPID1);
+    // The compiled words are indexed as the register cache, R0..R7 then R4/R5/R6 with SEL = 1
+    for (i = 0; i < ADF4159_CHIRP_REGS; i++) {
+        reg_cache_set(&ADF4159_regs, i, plan.reg[i]);
     }
+    lock_detect_arm(LOCK_ADF4159);
+    (void) reg_cache_flush(&ADF4159_regs);
 
-    //chThdSleepMilliseconds(200);
-    spiStop(&SPID1);
-    spiReleaseBus(&SPID1);
+    return true;
+}
 
+/*
+ * First ramp complete edge after the boot
+ */
+static thread_reference_t first_ramp_thread;
+static rtcnt_t first_ramp_stamp;
+static bool first_ramp_seen;
 
-    /*
-     * Program ADF4159 with desired register values
-     */
+/*
+ *@brief  ADF4159 ramp complete edge while the boot waits for the first chirp, called from the EXTI ISR
+ */
 
-    spiAcquireBus(&SPID1);
-    spiStart(&SPID1, &hs_spicfg);
+static void first_ramp_cb(rtcnt_t stamp){
 
-    // Configure ADF4159 registers
-    for(i = 0; i < 8; i++){
-        spiSelect(&SPID1);
-        spiSend(&SPID1,4,ADF4159_register_values_buf[i]);
-        spiUnselect(&SPID1);
+    osalSysLockFromISR();
+    if (!first_ramp_seen) {
+        first_ramp_seen  = true;
+        first_ramp_stamp = stamp;
+        osalThreadResumeI(&first_ramp_thread, MSG_OK);
     }
+    osalSysUnlockFromISR();
+}
+
+/*
+ *@brief  Starts the ADF4159 ramp with MUXOUT on ramp complete and waits for the first ramp complete edge
+ *@note   Returns false if no edge came within ADF4159_FIRST_RAMP_TIMEOUT_MS. The edge hook keeps the MUXOUT
+ *        line either way, lock detection of the ADF4159 stays suspended while MUXOUT is ramp complete; the
+ *        capture in ramp trigger mode replaces the hook with its own
+ */
+
+static bool ADF4159_start_ramp(void){
+
+    msg_t msg = MSG_OK;
+
+    PROBE_BEGIN("ADF4159_start_ramp");
 
-    //chThdSleepMilliseconds(200);
-    spiStop(&SPID1);
-    spiReleaseBus(&SPID1);
+    // The hook takes the line before MUXOUT leaves lock detect
+    first_ramp_seen = false;
+    lock_detect_set_edge_hook(LOCK_ADF4159, first_ramp_cb);
 
+    reg_cache_set_field(&ADF4159_regs, 4, ADF4159_R4_STATUS_MASK, ADF4159_R4_RAMP_COMPLETE);
+    reg_cache_set_field(&ADF4159_regs, ADF4159_REG4_SEL1, ADF4159_R4_STATUS_MASK, ADF4159_R4_RAMP_COMPLETE);
+    reg_cache_set_field(&ADF4159_regs, 0, ADF4159_R0_RAMP_ON | ADF4159_R0_MUXOUT_MASK,
+                        ADF4159_R0_RAMP_ON | ((uint32_t)ADF4159_MUXOUT_RAMP_COMPLETE << 27));
+    (void) reg_cache_flush(&ADF4159_regs);
+
+    osalSysLock();
+    if (!first_ramp_seen) {
+        msg = osalThreadSuspendTimeoutS(&first_ramp_thread, MS2ST(ADF4159_FIRST_RAMP_TIMEOUT_MS));
+    }
+    osalSysUnlock();
+
+    PROBE_END("ADF4159_start_ramp");
+
+    return msg == MSG_OK;
 }
 
+/*
+ *@brief  Returns the time of the first ramp complete edge after the boot (CPU cycles since timing_probe_init()),
+ *        0 if front_end_boot() did not see one
+ */
 
-void ADF4355_init(void){
+rtcnt_t front_end_first_chirp(void){
 
-    int i;
+    return first_ramp_seen ? first_ramp_stamp : 0U;
+}
+
+
+/*
+ *@brief  First ADF4355 load - registers 12-1, registers 4/2/1 at fPFD / 2
+ */
+
+static void ADF4355_program_phase1(const uint8_t buf1[12][4]){
+
+    const spi_sequence_t seq1[] = { SPI_SEQUENCE_N(buf1, 12) };
 
     /*
      * Program ADF4355 with power-on register values, i.e. load registers from 12-1, note that registers 4/2/1 use fPFD/2 value
      */
 
-    //Select multiplexed line for ADF4355
-    palClearPad(GPIOG, GPIOG_SPI_NSS_S0);
-    palSetPad(GPIOG, GPIOG_SPI_NSS_S1);
+    lock_detect_arm(LOCK_ADF4355);
+    spi_device_send(SPI_ADF4355, seq1, SEQ_LEN(seq1));
 
-    spiAcquireBus(&SPID1);
-    spiStart(&SPID1, &hs_spicfg);
+    reg_cache_sync(&ADF4355_regs, &buf1[0][0], 12);
+}
 
-    // Configure ADF4355 registers
-    for(i = 0; i < 12; i++){
-        spiSelect(&SPID1);
-        spiSend(&SPID1,4,ADF4355_power_on_register_values_buf1[i]);
-        spiUnselect(&SPID1);
-    }
+/*
+ *@brief  Second ADF4355 load - registers 0, 4, 2, 1, 0, registers 4/2/1/0 at the desired fPFD
+ */
 
-    //chThdSleepMilliseconds(200);
-    spiStop(&SPID1);
-    spiReleaseBus(&SPID1);
+static void ADF4355_program_phase2(const uint8_t buf2[5][4]){
 
-    chThdSleepMilliseconds(1); // Have to wait > 16 ADC_CLK cycles, which with ADC_CLK = 100 KHz is 161 uS, however with fPFD being divided by 2 this may be 50 KHz, hence meaning > 320 uS for 16 ADC_CLK cycles - wait for 1 mS to ensure compliance
+    const spi_sequence_t seq2[] = { SPI_SEQUENCE_N(buf2, 5) };
 
     /*
      * Program ADF4355 with power-on register values, i.e. load registers 0, 4, 2, 1, 0, note that registers 4/2/1/0 use desired fPFD value upon 2nd load
      */
 
-    spiAcquireBus(&SPID1);
-    spiStart(&SPID1, &hs_spicfg);
+    // Re-armed so a lock edge of the interim fPFD / 2 configuration does not complete the wait for the final one
+    lock_detect_arm(LOCK_ADF4355);
+    spi_device_send(SPI_ADF4355, seq2, SEQ_LEN(seq2));
+
+    reg_cache_sync(&ADF4355_regs, &buf2[0][0], 5);
+}
+
+/*
+ *@brief  Wait between the two ADF4355 loads - 16 ADC_CLK cycles, ADC_CLK from the R4 (index 8) and R10 (index 2)
+ *        words of the first load, i.e. 320.6 uS at fPFD / 2 = 50 MHz with an ADC clock divider of 250
+ */
+
+static uint32_t ADF4355_phase1_wait_ns(const uint8_t buf1[12][4]){
+
+    uint32_t r4  = ((uint32_t)buf1[8][0] << 24) | ((uint32_t)buf1[8][1] << 16) | ((uint32_t)buf1[8][2] << 8) | buf1[8][3];
+    uint32_t r10 = ((uint32_t)buf1[2][0] << 24) | ((uint32_t)buf1[2][1] << 16) | ((uint32_t)buf1[2][2] << 8) | buf1[2][3];
+
+    return adf4355_adc_wait_ns(adf4355_fpfd_hz(ADF4355_REF_HZ, r4), r10);
+}
+
+/*
+ *@brief  Two-phase ADF4355 programming of a pair of register tables
+ *@note   buf1 holds registers 12-1 with 4/2/1 at fPFD / 2, buf2 holds registers 0, 4, 2, 1, 0
+ */
+
+static void ADF4355_program(const uint8_t buf1[12][4], const uint8_t buf2[5][4]){
+
+    ADF4355_program_phase1(buf1);
+
+    hw_delay_ns(ADF4355_phase1_wait_ns(buf1)); // Have to wait > 16 ADC_CLK cycles at the halved fPFD before the 2nd load
 
-    // Configure ADF4355 registers
-    for(i = 0; i < 5; i++){
-        spiSelect(&SPID1);
-        spiSend(&SPID1,4,ADF4355_power_on_register_values_buf2[i]);
-        spiUnselect(&SPID1);
+    ADF4355_program_phase2(buf2);
+}
+
+/*
+ *@brief  Stores a 32-bit control word MSB first into a register table row
+ */
+
+static void word_put(uint8_t row[4], uint32_t word){
+
+    row[0] = (uint8_t)(word >> 24);
+    row[1] = (uint8_t)(word >> 16);
+    row[2] = (uint8_t)(word >> 8);
+    row[3] = (uint8_t)word;
+}
+
+
+void ADF4355_init(void){
+
+    PROBE_BEGIN("ADF4355_init");
+
+    ADF4355_program(ADF4355_power_on_register_values_buf1, ADF4355_power_on_register_values_buf2);
+
+    PROBE_END("ADF4355_init");
+}
+
+/*
+ *@brief  First load of ADF4355_init(), for the boot sequencer
+ *@note   ADF4355_init_phase2() must follow after 16 ADC_CLK cycles
+ */
+
+void ADF4355_init_phase1(void){
+
+    PROBE_BEGIN("ADF4355_init_phase1");
+
+    ADF4355_program_phase1(ADF4355_power_on_register_values_buf1);
+
+    PROBE_END("ADF4355_init_phase1");
+}
+
+/*
+ *@brief  Second load of ADF4355_init(), for the boot sequencer
+ */
+
+void ADF4355_init_phase2(void){
+
+    PROBE_BEGIN("ADF4355_init_phase2");
+
+    ADF4355_program_phase2(ADF4355_power_on_register_values_buf2);
+
+    PROBE_END("ADF4355_init_phase2");
+}
+
+/*
+ *@brief  ADF4355 power-on programming for an arbitrary output frequency
+ *@note   The frequency words of the power-on tables (R6 divider, R2/R1/R0 of both passes) are replaced by the
+ *        values computed by adf4355_plan_two_phase(), the other registers are kept. Returns false, without
+ *        touching the device, when the frequency cannot be synthesized
+ */
+
+bool ADF4355_init_frequency(uint64_t rfout_hz){
+
+    static uint8_t buf1[12][4];
+    static uint8_t buf2[5][4];
+    adf4355_two_phase_t plan;
+
+    if (!adf4355_plan_two_phase(rfout_hz, ADF4355_FPFD_HZ, 0U, 0U, &plan)) {
+        return false;
     }
 
-    //chThdSleepMilliseconds(200);
-    spiStop(&SPID1);
-    spiReleaseBus(&SPID1);
+    memcpy(buf1, ADF4355_power_on_register_values_buf1, sizeof(buf1));
+    memcpy(buf2, ADF4355_power_on_register_values_buf2, sizeof(buf2));
+
+    word_put(buf1[6], adf4355_r6_rfdiv(((uint32_t)buf1[6][0] << 24) | ((uint32_t)buf1[6][1] << 16) |
+                                       ((uint32_t)buf1[6][2] << 8) | buf1[6][3], plan.full.rf_div_sel));
+    word_put(buf1[10], plan.half.r2);
+    word_put(buf1[11], plan.half.r1);
+    word_put(buf2[0], plan.half.r0);
+    word_put(buf2[2], plan.full.r2);
+    word_put(buf2[3], plan.full.r1);
+    word_put(buf2[4], plan.full.r0);
 
+    ADF4355_program(buf1, buf2);
+
+    return true;
 }
 
 
 void ADA8282_init(void){
 
-    int i;
+    PROBE_BEGIN("ADA8282_init");
 
     /*
      * Program ADA8282 U404/U405 with power-on register values
      */
 
-    //Select multiplexed line for ADA8282 / U404
-    palSetPad(GPIOG, GPIOG_SPI_NSS_S0);
-    palClearPad(GPIOG, GPIOG_SPI_NSS_S1);
-
     // Configure ADA8282 / U404 registers
-    for(i = 0; i < 7; i++){
-      spiAcquireBus(&SPID1);
-      spiStart(&SPID1, &hs_spicfg);
-      spiSelect(&SPID1);
-      //spiSend(&SPID1,3,ADA8282_U404_power_on_register_values[i]);
-      spiSend(&SPID1,3,ADA8282_U404_power_on_register_values[i]);
-      spiUnselect(&SPID1);
-      //chThdSleepMilliseconds(200);
-      spiStop(&SPID1);
-      spiReleaseBus(&SPID1);
+    spi_device_send(SPI_ADA8282_U404, ADA8282_U404_seq, SEQ_LEN(ADA8282_U404_seq));
+    reg_cache_sync(&ADA8282_U404_regs, &ADA8282_U404_power_on_register_values[0][0], 7);
+
+    // Configure ADA8282 / U405 registers
+    spi_device_send(SPI_ADA8282_U405, ADA8282_U405_seq, SEQ_LEN(ADA8282_U405_seq));
+    reg_cache_sync(&ADA8282_U405_regs, &ADA8282_U405_power_on_register_values[0][0], 7);
+
+    PROBE_END("ADA8282_init");
+}
+
+
+/*
+ *@brief  Configuration integrity check - reads back every programmed ADA8282 U404/U405 and AD9648 register
+ *@note   Returns true when all registers hold their intended values, mismatches are listed in report
+ */
+
+bool ADA8282_AD9648_verify(reg_verify_report_t *report){
+
+    static reg_cache_t *const caches[] = {
+            &ADA8282_U404_regs,
+            &ADA8282_U405_regs,
+            &AD9648_regs
+    };
+
+    return reg_verify(caches, 3, report);
+
+}
+
+
+/*
+ *@brief  ADA8282 request completion - records the programmed values in the shadow register image
+ */
+
+static void ADA8282_request_done(spi_request_t *req){
+
+    if (req->dev == SPI_ADA8282_U404) {
+        reg_cache_sync(&ADA8282_U404_regs, &ADA8282_U404_power_on_register_values[0][0], 7);
+    }
+    else {
+        reg_cache_sync(&ADA8282_U405_regs, &ADA8282_U405_power_on_register_values[0][0], 7);
+    }
+
+}
+
+/*
+ *@brief  Non-blocking ADA8282 U404/U405 setup through the SPI request queue
+ *@note   Both batches are posted at the given priority, events are signalled to tp once U405 has been programmed,
+ *        the function must not be called again before that
+ */
+
+void ADA8282_init_async(uint8_t prio, thread_t *tp, eventmask_t events){
+
+    static spi_request_t req[2];
+
+    req[0].dev    = SPI_ADA8282_U404;
+    req[0].list   = ADA8282_U404_seq;
+    req[0].n      = SEQ_LEN(ADA8282_U404_seq);
+    req[0].prio   = prio;
+    req[0].cb     = ADA8282_request_done;
+    req[0].thread = NULL;
+
+    req[1].dev    = SPI_ADA8282_U405;
+    req[1].list   = ADA8282_U405_seq;
+    req[1].n      = SEQ_LEN(ADA8282_U405_seq);
+    req[1].prio   = prio;
+    req[1].cb     = ADA8282_request_done;
+    req[1].thread = tp;
+    req[1].events = events;
+
+    spi_queue_post(&req[0]);
+    spi_queue_post(&req[1]);
+
+}
+
+
+/*
+ *@brief  SPI bus time benchmark - programs every device SPI_BENCHMARK_ROUNDS times
+ *@note   Returns the mean bus time of one complete programming sequence per device, in CPU cycles
+ */
+
+void SPI_bus_benchmark(uint32_t cycles[SPI_DEVICE_COUNT]){
+
+    rttime_t start[SPI_DEVICE_COUNT];
+    int i;
+
+    for(i = 0; i < SPI_DEVICE_COUNT; i++){
+        start[i] = spi_device_get_bus_time(&spi_devices[i])->cumulative;
     }
 
-    //Select multiplexed line for ADA8282 / U405
-        palSetPad(GPIOG, GPIOG_SPI_NSS_S0);
-        palSetPad(GPIOG, GPIOG_SPI_NSS_S1);
-
-        // Configure ADA8282 / U405 registers
-        for(i = 0; i < 7; i++){
-          spiAcquireBus(&SPID1);
-          spiStart(&SPID1, &hs_spicfg);
-          spiSelect(&SPID1);
-          spiSend(&SPID1,3,ADA8282_U405_power_on_register_values[i]);
-          spiUnselect(&SPID1);
-          //chThdSleepMilliseconds(200);
-          spiStop(&SPID1);
-          spiReleaseBus(&SPID1);
-        }
+    for(i = 0; i < SPI_BENCHMARK_ROUNDS; i++){
+        ADF4159_init();
+        ADF4355_init();
+        ADA8282_init();
+        AD9648_read_func();
+    }
+
+    for(i = 0; i < SPI_DEVICE_COUNT; i++){
+        cycles[i] = (uint32_t)((spi_device_get_bus_time(&spi_devices[i])->cumulative - start[i]) / SPI_BENCHMARK_ROUNDS);
+    }
+
+}
+
+/*
+ *@brief  Prints the SPI bus time benchmark results, one line per device
+ */
+
+void SPI_bus_benchmark_report(BaseSequentialStream *chp, const uint32_t cycles[SPI_DEVICE_COUNT]){
+
+    const spi_profile_t *profile;
+    int i;
+
+    chprintf(chp, "SPI bus time per programming sequence, mean of %u rounds\r\n", SPI_BENCHMARK_ROUNDS);
+    chprintf(chp, "  device             sclk Hz     cycles      us\r\n");
+    for(i = 0; i < SPI_DEVICE_COUNT; i++){
+        profile = spi_profile_get((spi_device_id_t)i);
+        chprintf(chp, "  %-14s %11u %10u %7u\r\n", profile->name, profile->sclk, cycles[i],
+                 (uint32_t)(((uint64_t)cycles[i] * 1000000U) / STM32_HCLK));
+    }
+
+}
+
+
+/*
+ * Front end boot table - prerequisites and wait conditions of every setup step, in programming priority order
+ */
+
+enum {
+    BOOT_POWER_UP = 0,
+    BOOT_ADF4355_PHASE1,
+    BOOT_ADF4159,
+    BOOT_ADA8282,
+    BOOT_ADF4355_PHASE2
+};
+
+static boot_step_t front_end_steps[] = {
+    [BOOT_POWER_UP]       = { "power up",       0,
+                              NULL,                BOOT_WAIT_SETTLE, FRONT_END_POWER_UP_MS * 1000000U, NULL, 0 },
+    [BOOT_ADF4355_PHASE1] = { "ADF4355 phase 1", BOOT_STEP(BOOT_POWER_UP),
+                              ADF4355_init_phase1, BOOT_WAIT_SETTLE, 0,  /* Set from the tables */  NULL, 0 },
+    [BOOT_ADF4159]        = { "ADF4159",         BOOT_STEP(BOOT_POWER_UP),
+                              ADF4159_init,        BOOT_WAIT_LOCK,   LOCK_ADF4159,                  NULL, 0 },
+    [BOOT_ADA8282]        = { "ADA8282",         BOOT_STEP(BOOT_POWER_UP),
+                              ADA8282_init,        BOOT_WAIT_NONE,   0,                             NULL, 0 },
+    [BOOT_ADF4355_PHASE2] = { "ADF4355 phase 2", BOOT_STEP(BOOT_ADF4355_PHASE1),
+                              ADF4355_init_phase2, BOOT_WAIT_LOCK,   LOCK_ADF4355,                  NULL, 0 }
+};
+
+/*
+ *@brief  Front end setup through the boot sequencer - ADF4159/ADF4355 programming and lock, ADA8282 setup,
+ *        then the ADF4159 ramp start
+ *@note   The ADA8282 and the ADF4159 are programmed while the ADF4355 waits between its two loads. With every
+ *        synthesizer locked the ramp is started and the boot ends on the first ramp complete edge, the first
+ *        chirp, see front_end_first_chirp(). Returns false when a synthesizer did not lock or no ramp complete
+ *        edge came, report holds the per step timing and the critical path of the sequencer
+ */
+
+bool front_end_boot(boot_report_t *report){
+
+    front_end_steps[BOOT_ADF4355_PHASE1].param = ADF4355_phase1_wait_ns(ADF4355_power_on_register_values_buf1);
+    // The power-on tables need > 320 uS, 16 ADC_CLK cycles at fPFD / 2 = 50 MHz with an ADC clock divider of 250
+    osalDbgAssert(front_end_steps[BOOT_ADF4355_PHASE1].param > 320000U, "ADF4355 settle below 16 ADC_CLK cycles");
+
+    if (!boot_run(front_end_steps, SEQ_LEN(front_end_steps), report)) {
+        return false;
+    }
 
+    return ADF4159_start_ramp();
 }
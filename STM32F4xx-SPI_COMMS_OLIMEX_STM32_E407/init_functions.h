@@ -3,12 +3,29 @@
 ///
 /// @author Peter Ludlow
 
+#pragma once
+
+#include "spi_profile.h"
+#include "reg_verify.h"
+#include "adf4159_chirp.h"
+#include "boot_seq.h"
+
 /*
  * Function declarations
  */
 void ADF4159_init(void);
+bool ADF4159_set_chirp(const adf4159_chirp_t *chirp);
 void ADF4355_init(void);
+void ADF4355_init_phase1(void);
+void ADF4355_init_phase2(void);
+bool ADF4355_init_frequency(uint64_t rfout_hz);
 void ADA8282_init(void);
 void AD9648_init(void);
 void AD9648_write_func(void);
 void AD9648_read_func(void);
+bool ADA8282_AD9648_verify(reg_verify_report_t *report);
+void ADA8282_init_async(uint8_t prio, thread_t *tp, eventmask_t events);
+void SPI_bus_benchmark(uint32_t cycles[SPI_DEVICE_COUNT]);
+void SPI_bus_benchmark_report(BaseSequentialStream *chp, const uint32_t cycles[SPI_DEVICE_COUNT]);
+bool front_end_boot(boot_report_t *report);
+rtcnt_t front_end_first_chirp(void);
@@ -0,0 +1,240 @@
+/// @file lock_detect.c
+/// @brief Synthesizer lock detection on the MUXOUT pins
+///
+/// The ADF4159 and ADF4355 MUXOUT pins, programmed to digital lock detect, drive two
+/// EXT interrupt lines. A rising edge timestamps the lock and broadcasts the event
+/// source of the synthesizer, so a thread waiting for lock is woken as soon as the
+/// PLL has settled instead of sleeping for a fixed time.
+///
+/// Programming a synthesizer that is already locked can leave MUXOUT high until the
+/// loop actually unlocks, so callers arm the detector before writing the frequency
+/// registers: once armed, only a rising edge seen after the arm counts as lock.
+///
+/// When MUXOUT is reprogrammed to another signal, an edge hook takes over the rising
+/// edges of that line and lock detection is suspended until the hook is removed. The
+/// line then interrupts on rising edges only and the hook runs on the EXTI edge itself,
+/// without re-reading the pin, so a pulse that has ended by the time the ISR runs (e.g.
+/// ADF4159 ramp complete) is not lost.
+///
+/// @author Peter Ludlow
+
+#include "ch.h"
+#include "hal.h"
+#include "lock_detect.h"
+
+typedef struct {
+    ioportid_t      port;       // MUXOUT input
+    iopadid_t       pad;
+    uint32_t        ext_mode;   // EXT_MODE_GPIOx of the port
+    event_source_t  source;     // Broadcast on every lock
+    volatile bool   armed;      // Waiting for a rising edge after lock_detect_arm()
+    volatile bool   edge;       // Rising edge seen since the arm
+    rtcnt_t         start;      // Realtime counter value at the arm
+    lock_edge_cb_t  hook;       // Rising edge hook, NULL while MUXOUT is lock detect
+    lock_stats_t    stats;
+} lock_state_t;
+
+static lock_state_t lock[LOCK_DEVICE_COUNT] = {
+        { .port = LOCK_ADF4159_PORT, .pad = LOCK_ADF4159_PAD, .ext_mode = LOCK_ADF4159_EXT_MODE },
+        { .port = LOCK_ADF4355_PORT, .pad = LOCK_ADF4355_PAD, .ext_mode = LOCK_ADF4355_EXT_MODE }
+};
+
+
+/*
+ *@brief  MUXOUT edge callback, called from the EXTI ISR
+ */
+
+static void lock_cb(EXTDriver *extp, expchannel_t channel){
+
+    rtcnt_t now = chSysGetRealtimeCounterX();
+    lock_state_t *l = (channel == LOCK_ADF4159_PAD) ? &lock[LOCK_ADF4159] : &lock[LOCK_ADF4355];
+    lock_edge_cb_t hook = l->hook;
+    rtcnt_t t;
+
+    (void)extp;
+
+    // With a hook the line interrupts on rising edges only, the edge is the event whatever the pin reads now
+    if (hook != NULL) {
+        hook(now);
+        return;
+    }
+
+    if (palReadPad(l->port, l->pad) == PAL_LOW) {
+        l->stats.losses++;
+        return;
+    }
+
+    t = now - l->start;
+    l->stats.last_lock = t;
+    if (t > l->stats.max_lock) {
+        l->stats.max_lock = t;
+    }
+    l->edge = true;
+
+    osalSysLockFromISR();
+    chEvtBroadcastI(&l->source);
+    osalSysUnlockFromISR();
+}
+
+// Not const, extSetChannelModeI() writes the new channel mode into the configuration
+static EXTConfig ext_cfg = {
+    {
+        [LOCK_ADF4159_PAD] = { EXT_CH_MODE_BOTH_EDGES | EXT_CH_MODE_AUTOSTART | LOCK_ADF4159_EXT_MODE, lock_cb },
+        [LOCK_ADF4355_PAD] = { EXT_CH_MODE_BOTH_EDGES | EXT_CH_MODE_AUTOSTART | LOCK_ADF4355_EXT_MODE, lock_cb }
+    }
+};
+
+
+/*
+ *@brief  Configures the MUXOUT inputs and starts the EXT driver, must be called once after chSysInit()
+ */
+
+void lock_detect_init(void){
+
+    int i;
+
+    for (i = 0; i < LOCK_DEVICE_COUNT; i++) {
+        chEvtObjectInit(&lock[i].source);
+        palSetPadMode(lock[i].port, lock[i].pad, PAL_MODE_INPUT_PULLDOWN);
+    }
+
+    extStart(&EXTD1, &ext_cfg);
+}
+
+/*
+ *@brief  Arms the detector before the frequency registers of a synthesizer are written
+ *@note   The next lock_detect_wait() only returns true on a rising edge after this call, the arm to lock
+ *        time is recorded in the statistics
+ */
+
+void lock_detect_arm(lock_device_t dev){
+
+    osalDbgCheck(dev < LOCK_DEVICE_COUNT);
+
+    chSysLock();
+    lock[dev].start = chSysGetRealtimeCounterX();
+    lock[dev].edge  = false;
+    lock[dev].armed = true;
+    chSysUnlock();
+}
+
+/*
+ *@brief  Waits for a synthesizer to lock
+ *@note   Without a previous arm a MUXOUT already high counts as locked. Returns false on timeout
+ */
+
+bool lock_detect_wait(lock_device_t dev, systime_t timeout){
+
+    lock_state_t *l;
+    event_listener_t el;
+    bool locked;
+
+    osalDbgCheck(dev < LOCK_DEVICE_COUNT);
+    l = &lock[dev];
+
+    chEvtRegisterMask(&l->source, &el, LOCK_DETECT_EVENT);
+
+    // Registered before sampling, a lock between the check and the wait still sets the event
+    locked = l->armed ? l->edge : (palReadPad(l->port, l->pad) == PAL_HIGH);
+    if (!locked) {
+        locked = (chEvtWaitAnyTimeout(LOCK_DETECT_EVENT, timeout) != 0U);
+    }
+
+    chEvtUnregister(&l->source, &el);
+    (void) chEvtGetAndClearEvents(LOCK_DETECT_EVENT);
+
+    l->stats.waits++;
+    if (locked) {
+        l->armed = false;
+    }
+    else {
+        l->stats.timeouts++;
+    }
+
+    return locked;
+}
+
+/*
+ *@brief  Non blocking lock check, with the same arm semantics as lock_detect_wait()
+ */
+
+bool lock_detect_poll(lock_device_t dev){
+
+    lock_state_t *l;
+    bool locked;
+
+    osalDbgCheck(dev < LOCK_DEVICE_COUNT);
+    l = &lock[dev];
+
+    locked = l->armed ? l->edge : (palReadPad(l->port, l->pad) == PAL_HIGH);
+    if (locked) {
+        l->armed = false;
+    }
+
+    return locked;
+}
+
+/*
+ *@brief  Returns the event source broadcast when a synthesizer locks, for waiting on several events at once
+ */
+
+event_source_t *lock_detect_get_source(lock_device_t dev){
+
+    osalDbgCheck(dev < LOCK_DEVICE_COUNT);
+
+    return &lock[dev].source;
+}
+
+/*
+ *@brief  Returns the current level of the lock detect output
+ */
+
+bool lock_detect_is_locked(lock_device_t dev){
+
+    osalDbgCheck(dev < LOCK_DEVICE_COUNT);
+
+    return palReadPad(lock[dev].port, lock[dev].pad) == PAL_HIGH;
+}
+
+/*
+ *@brief  Returns the lock statistics of a synthesizer
+ */
+
+const lock_stats_t *lock_detect_get_stats(lock_device_t dev){
+
+    osalDbgCheck(dev < LOCK_DEVICE_COUNT);
+
+    return &lock[dev].stats;
+}
+
+/*
+ *@brief  Hands the rising edges of a MUXOUT line to cb, NULL returns the line to lock detection
+ *@note   Set the hook before MUXOUT is reprogrammed away from lock detect, remove it after. The line interrupts
+ *        on rising edges only while a hook is set, on both edges for lock detection
+ */
+
+void lock_detect_set_edge_hook(lock_device_t dev, lock_edge_cb_t cb){
+
+    EXTChannelConfig ch;
+
+    osalDbgCheck(dev < LOCK_DEVICE_COUNT);
+
+    ch.mode = ((cb != NULL) ? EXT_CH_MODE_RISING_EDGE : EXT_CH_MODE_BOTH_EDGES) | EXT_CH_MODE_AUTOSTART | lock[dev].ext_mode;
+    ch.cb   = lock_cb;
+
+    chSysLock();
+    lock[dev].hook = cb;
+    extSetChannelModeI(&EXTD1, (expchannel_t)lock[dev].pad, &ch);
+    chSysUnlock();
+}
+
+/*
+ *@brief  Returns true while an edge hook holds the MUXOUT line, lock detection is then suspended
+ */
+
+bool lock_detect_hooked(lock_device_t dev){
+
+    osalDbgCheck(dev < LOCK_DEVICE_COUNT);
+
+    return lock[dev].hook != NULL;
+}
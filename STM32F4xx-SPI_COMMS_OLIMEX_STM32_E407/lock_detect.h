@@ -0,0 +1,74 @@
+/// @file lock_detect.h
+/// @brief Variable/Function Declarations - Synthesizer lock detection on the MUXOUT pins
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+#include "hal.h"
+
+/*
+ * MUXOUT inputs, MUXOUT of each synthesizer programmed to digital lock detect. The pads must be on
+ * different EXTI lines, EXT_MODE_GPIOx must match the port
+ */
+#if !defined(LOCK_ADF4159_PORT)
+#define LOCK_ADF4159_PORT       GPIOE
+#define LOCK_ADF4159_PAD        2U
+#define LOCK_ADF4159_EXT_MODE   EXT_MODE_GPIOE
+#endif
+
+#if !defined(LOCK_ADF4355_PORT)
+#define LOCK_ADF4355_PORT       GPIOE
+#define LOCK_ADF4355_PAD        3U
+#define LOCK_ADF4355_EXT_MODE   EXT_MODE_GPIOE
+#endif
+
+/// Default time allowed for a synthesizer to lock (mS)
+#if !defined(LOCK_DETECT_TIMEOUT_MS)
+#define LOCK_DETECT_TIMEOUT_MS  10U
+#endif
+
+/// Thread event used while waiting for lock
+#if !defined(LOCK_DETECT_EVENT)
+#define LOCK_DETECT_EVENT       EVENT_MASK(31)
+#endif
+
+/*
+ * Synthesizers with a lock detect input
+ */
+typedef enum {
+    LOCK_ADF4159 = 0,
+    LOCK_ADF4355,
+    LOCK_DEVICE_COUNT
+} lock_device_t;
+
+/*
+ * MUXOUT edge hook, called from the EXTI ISR on each rising edge with the realtime counter value read on
+ * entry, while MUXOUT carries another signal than lock detect (e.g. ADF4159 ramp complete)
+ */
+typedef void (*lock_edge_cb_t)(rtcnt_t stamp);
+
+/*
+ * Lock statistics of one synthesizer
+ */
+typedef struct {
+    uint32_t waits;         ///< Number of lock_detect_wait() calls
+    uint32_t timeouts;      ///< Waits that timed out
+    uint32_t losses;        ///< Lock detect falling edges
+    rtcnt_t  last_lock;     ///< Arm to lock time of the last lock (CPU cycles)
+    rtcnt_t  max_lock;      ///< Worst arm to lock time (CPU cycles)
+} lock_stats_t;
+
+/*
+ * Function declarations
+ */
+void lock_detect_init(void);
+void lock_detect_arm(lock_device_t dev);
+bool lock_detect_wait(lock_device_t dev, systime_t timeout);
+bool lock_detect_poll(lock_device_t dev);
+event_source_t *lock_detect_get_source(lock_device_t dev);
+bool lock_detect_is_locked(lock_device_t dev);
+const lock_stats_t *lock_detect_get_stats(lock_device_t dev);
+void lock_detect_set_edge_hook(lock_device_t dev, lock_edge_cb_t cb);
+bool lock_detect_hooked(lock_device_t dev);
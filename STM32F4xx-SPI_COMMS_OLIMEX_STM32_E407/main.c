@@ -26,6 +26,16 @@
 #include "hal.h"
 #include "global.h"
 #include "init_functions.h"
+#include "spi_queue.h"
+#include "lock_detect.h"
+#include "hw_delay.h"
+#include "timing_probe.h"
+#include "chprintf.h"
+#include "fft_bench.h"
+#include "rd_bench.h"
+#include "decim_bench.h"
+#include "preproc_bench.h"
+#include "capture_bench.h"
 
 
 
@@ -41,27 +51,146 @@ int main(void) {
    * - Kernel initialization, the main() function becomes a thread and the
    *   RTOS is active.
    */
+  timing_probe_init();
+  PROBE_BEGIN("halInit");
   halInit();
+  PROBE_END("halInit");
+  PROBE_BEGIN("chSysInit");
   chSysInit();
+  PROBE_END("chSysInit");
 
   /*
-   * Setup of ADF4159/ADF4355/ADA8282 register values
+   * Hardware timed settle delays
    */
-  chThdSleepMilliseconds(1000);
-  ADF4159_init();
-  chThdSleepMilliseconds(1000);
-  ADF4355_init();
-  chThdSleepMilliseconds(1000);
-  ADA8282_init();
-  chThdSleepMilliseconds(1000);
+  hw_delay_init();
+
+  /*
+   * Asynchronous SPI request queue driver thread
+   */
+  spi_queue_init();
+
+  /*
+   * Synthesizer lock detect inputs
+   */
+  lock_detect_init();
+
+  /*
+   * Setup of ADF4159/ADF4355/ADA8282 register values, steps are interleaved on the SPI bus while the
+   * synthesizers lock, boot_report.failed has a bit set for each step that failed. The ADF4159 ramp is
+   * started once every synthesizer is locked
+   */
+  static boot_report_t boot_report;
+  PROBE_BEGIN("front_end_boot");
+  bool chirping = front_end_boot(&boot_report);
+  PROBE_END("front_end_boot");
+
+  /*
+   * Boot to first chirp time, from the start of main() where the cycle counter was cleared to the first
+   * ADF4159 ramp complete edge. The reset and the __early_init clock and PLL start-up before main() are not
+   * included. Without a first chirp the time to the end of front_end_boot() is reported and the budget is
+   * missed. In fast boot mode the budget is asserted in debug builds and reported through the LED in
+   * production builds
+   */
+  bool over_budget = false;
+#if FAST_BOOT || TIMING_PROBES
+  rtcnt_t boot_end = chirping ? front_end_first_chirp() : chSysGetRealtimeCounterX();
+  uint32_t boot_us = (uint32_t)(((uint64_t)boot_end * 1000000U) / STM32_HCLK);
+#endif
+#if FAST_BOOT
+  over_budget = !chirping || (boot_us > (FAST_BOOT_BUDGET_MS * 1000U));
+  osalDbgAssert(!over_budget, "boot budget exceeded");
+#endif
+
+  /*
+   * Read back and check the ADA8282/AD9648 configuration. The AD9648 is not programmed at boot (AD9648_init()
+   * below is disabled), no register of it is known, so only the ADA8282 registers are read back for now
+   */
+  static reg_verify_report_t verify_report;
+  bool verify_ok = ADA8282_AD9648_verify(&verify_report);
 
   //AD9648_init();
 //  chThdSleepMilliseconds(1000);
 
+#if TIMING_PROBES
+  /*
+   * Boot phase timing report on USART6
+   */
+  sdStart(&SD6, NULL);
+  timing_probe_report((BaseSequentialStream *)&SD6);
+  chprintf((BaseSequentialStream *)&SD6, "Boot to %s %u us%s\r\n", chirping ? "first chirp" : "front end, no chirp",
+           boot_us, over_budget ? ", over budget" : "");
+  reg_verify_report_print((BaseSequentialStream *)&SD6, &verify_report);
+#endif
+
+#if SPI_BUS_BENCHMARK
+  /*
+   * SPI bus time per device, in CPU cycles
+   */
+  static uint32_t spi_bus_cycles[SPI_DEVICE_COUNT];
+  SPI_bus_benchmark(spi_bus_cycles);
+  sdStart(&SD6, NULL);
+  SPI_bus_benchmark_report((BaseSequentialStream *)&SD6, spi_bus_cycles);
+#endif
 
+#if FFT_BENCHMARK
   /*
-   * Normal main() thread activity, the LED on the PCB blinks on and off at 0.1 second intervals
+   * FFT kernel time per transform, in CPU cycles
    */
+  static fft_bench_t fft_cycles[FFT_BENCH_SIZES];
+  fft_benchmark(fft_cycles);
+  sdStart(&SD6, NULL);
+  fft_benchmark_report((BaseSequentialStream *)&SD6, fft_cycles);
+#endif
+
+#if RD_BENCHMARK
+  /*
+   * Range-Doppler frame time per geometry, in CPU cycles
+   */
+  static rd_bench_t rd_cycles[RD_BENCH_CONFIGS];
+  rd_benchmark(rd_cycles);
+  sdStart(&SD6, NULL);
+  rd_benchmark_report((BaseSequentialStream *)&SD6, rd_cycles);
+#endif
+
+#if DECIM_BENCHMARK
+  /*
+   * CIC and FIR decimation time per factor, in CPU cycles
+   */
+  static decim_bench_t decim_cycles[DECIM_BENCH_FACTORS];
+  decim_benchmark(decim_cycles);
+  sdStart(&SD6, NULL);
+  decim_benchmark_report((BaseSequentialStream *)&SD6, decim_cycles);
+#endif
+
+#if PREPROC_BENCHMARK
+  /*
+   * Chirp preprocessing time, separate passes against the fused pass, in CPU cycles
+   */
+  static pre_bench_t pre_cycles[PRE_BENCH_SIZES];
+  pre_benchmark(pre_cycles);
+  sdStart(&SD6, NULL);
+  pre_benchmark_report((BaseSequentialStream *)&SD6, pre_cycles);
+#endif
+
+#if CAPTURE_BENCHMARK
+  /*
+   * Capture and range-Doppler throughput, chirps and sample pairs per second
+   */
+  static capture_bench_t capture_run;
+  sdStart(&SD6, NULL);
+  if (capture_benchmark(&capture_run)) {
+    capture_benchmark_report((BaseSequentialStream *)&SD6, &capture_run);
+  }
+#endif
+
+
+  /*
+   * Normal main() thread activity, the LED on the PCB blinks on and off at 0.5 second intervals,
+   * or at 0.1 second intervals when a boot step failed, the ramp did not start, a register did not
+   * read back as programmed or the fast boot budget was exceeded
+   */
+  uint32_t blink_ms = ((boot_report.failed != 0U) || !chirping || !verify_ok || over_budget) ? 100U : 500U;
+
   while (true) {
 
 
@@ -77,8 +206,8 @@ int main(void) {
 //    AD9648_read_func();
 
     palSetPad(GPIOC, GPIOC_LED_SPI);
-    chThdSleepMilliseconds(500);
+    chThdSleepMilliseconds(blink_ms);
     palClearPad(GPIOC, GPIOC_LED_SPI);
-    chThdSleepMilliseconds(500);
+    chThdSleepMilliseconds(blink_ms);
   }
 }
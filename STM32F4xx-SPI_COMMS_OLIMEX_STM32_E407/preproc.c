@@ -0,0 +1,191 @@
+/// @file preproc.c
+/// @brief Fused DC removal, I/Q correction and windowing of a chirp
+///
+/// Replaces the plain offset binary to Q15 conversion ahead of the range FFT. One pass
+/// reads each captured sample pair once and writes the corrected, windowed Q15 complex
+/// sample (cq15_t) back in place, where separate conversion, DC, I/Q and window loops
+/// would read and write the whole chirp four times.
+///
+/// Per sample pair word, channel A low (I) and channel B high (Q):
+///  - the offset binary to Q15 conversion of both channels in three operations
+///  - DC removal of both channels with one QSUB16
+///  - the corrected Q as one SMUAD of the pair with the packed Q14 coefficients
+///  - both channels scaled by the window entry, read from the flash table with a stride
+///
+/// The DC is the mean of the chirp itself (PRE_DC_CHIRP), found by a read-only summing
+/// pass first, or the mean of the previous chirp (PRE_DC_TRACK), summed by the fused
+/// pass itself. The tracked mean is shared, one processing chain runs at a time and
+/// resets it with pre_reset() when it starts.
+///
+/// The raw sample pass is specialised for each combination of options so the loop
+/// carries no tests. The Q15 variant runs after decimation on a chirp the decimation
+/// factor shorter, its options are tested per sample.
+///
+/// @author Peter Ludlow
+
+#include <stddef.h>
+#include "preproc.h"
+#include "dsp_simd.h"
+
+// Packed Q15 DC of the previous chirp, PRE_DC_TRACK
+static uint32_t pre_track;
+
+
+/*===============================================================*/
+/*Fused Pass                                                     */
+/*===============================================================*/
+
+/*
+ *@brief  Packed Q15 mean of both channels of a chirp, raw offset binary or Q15 sample pairs
+ */
+
+static uint32_t pre_mean(const uint32_t *x, uint32_t n, bool raw){
+
+    uint32_t i;
+    uint32_t w;
+    int32_t sa = 0;
+    int32_t sb = 0;
+
+    if (raw) {
+        for (i = 0U; i < n; i++) {
+            w = x[i];
+            sa += (int32_t)(w & 0x3FFFU);
+            sb += (int32_t)((w >> 16) & 0x3FFFU);
+        }
+
+        // Q15 of the 14-bit mean, 4 * (mean - mid scale)
+        return dsp_pkhbt((((4 * sa) + (int32_t)(n / 2U)) / (int32_t)n) - 0x8000,
+                         (((4 * sb) + (int32_t)(n / 2U)) / (int32_t)n) - 0x8000);
+    }
+
+    for (i = 0U; i < n; i++) {
+        w = x[i];
+        sa += (int16_t)(w & 0xFFFFU);
+        sb += (int32_t)w >> 16;
+    }
+
+    return dsp_pkhbt(sa / (int32_t)n, sb / (int32_t)n);
+}
+
+/*
+ *@brief  The fused pass, inlined with constant options into each specialisation
+ *@note   The SMUAD wraps if |I * iq_phase + Q * iq_gain| exceeds 2^31, which needs coefficients far from 1 and 0
+ */
+
+static inline __attribute__((always_inline)) void pre_pass(uint32_t *x, uint32_t n, const pre_config_t *cfg,
+                                                           bool raw, bool iq, bool window, bool track){
+
+    uint32_t i;
+    uint32_t p;
+    uint32_t dc = 0U;
+    uint32_t coef = dsp_pkhbt(cfg->iq_phase, cfg->iq_gain);
+    const int16_t *win = NULL;
+    uint32_t stride = 0U;
+    int32_t re, im, g;
+    int32_t sa = 0;
+    int32_t sb = 0;
+
+    if (cfg->dc == PRE_DC_CHIRP) {
+        dc = pre_mean(x, n, raw);
+    }
+    else if (cfg->dc == PRE_DC_TRACK) {
+        dc = pre_track;
+    }
+
+    if (window) {
+        win = pre_window[cfg->window - 1U];
+        stride = PRE_WINDOW_POINTS / n;
+    }
+
+    for (i = 0U; i < n; i++) {
+        p = x[i];
+        if (raw) {
+            p = ((p & 0x3FFF3FFFU) ^ 0x20002000U) << 2;
+        }
+        if (track) {
+            sa += (int16_t)(p & 0xFFFFU);
+            sb += (int32_t)p >> 16;
+        }
+
+        p = dsp_qsub16(p, dc);
+        re = (int16_t)(p & 0xFFFFU);
+        im = iq ? dsp_sat16(dsp_smuad(p, coef) >> 14) : ((int32_t)p >> 16);
+
+        if (window) {
+            g = win[i * stride];
+            re = ((re * g) + 0x4000) >> 15;
+            im = ((im * g) + 0x4000) >> 15;
+        }
+
+        x[i] = dsp_pkhbt(re, im);
+    }
+
+    if (track) {
+        pre_track = dsp_pkhbt(sa / (int32_t)n, sb / (int32_t)n);
+    }
+}
+
+
+/*===============================================================*/
+/*Preprocessing                                                  */
+/*===============================================================*/
+
+/*
+ *@brief  Returns true if the configuration can process chirps of n sample pairs
+ *@note   A window needs a power of two n up to PRE_WINDOW_POINTS
+ */
+
+bool pre_supported(const pre_config_t *cfg, uint32_t n){
+
+    if ((n == 0U) || (cfg->dc > PRE_DC_TRACK) || (cfg->window > PRE_WINDOW_BLACKMAN)) {
+        return false;
+    }
+
+    if ((cfg->window != PRE_WINDOW_NONE) && ((n < 2U) || (n > PRE_WINDOW_POINTS) || ((n & (n - 1U)) != 0U))) {
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ *@brief  Clears the tracked DC, called when a processing chain starts
+ */
+
+void pre_reset(void){
+
+    pre_track = 0U;
+}
+
+/*
+ *@brief  Preprocesses n captured sample pairs (adc_sample_t) in place into Q15 complex samples (cq15_t)
+ *@note   The configuration must pass pre_supported() for n
+ */
+
+void pre_to_q15(void *buf, uint32_t n, const pre_config_t *cfg){
+
+    bool iq = cfg->iq;
+    bool window = (cfg->window != PRE_WINDOW_NONE);
+    bool track = (cfg->dc == PRE_DC_TRACK);
+
+    switch ((iq ? 1U : 0U) | (window ? 2U : 0U) | (track ? 4U : 0U)) {
+    case 0U: pre_pass(buf, n, cfg, true, false, false, false); break;
+    case 1U: pre_pass(buf, n, cfg, true, true,  false, false); break;
+    case 2U: pre_pass(buf, n, cfg, true, false, true,  false); break;
+    case 3U: pre_pass(buf, n, cfg, true, true,  true,  false); break;
+    case 4U: pre_pass(buf, n, cfg, true, false, false, true);  break;
+    case 5U: pre_pass(buf, n, cfg, true, true,  false, true);  break;
+    case 6U: pre_pass(buf, n, cfg, true, false, true,  true);  break;
+    default: pre_pass(buf, n, cfg, true, true,  true,  true);  break;
+    }
+}
+
+/*
+ *@brief  Preprocesses n Q15 complex samples (cq15_t) in place, the output of the decimation
+ *@note   The configuration must pass pre_supported() for n
+ */
+
+void pre_q15(void *buf, uint32_t n, const pre_config_t *cfg){
+
+    pre_pass(buf, n, cfg, false, cfg->iq, cfg->window != PRE_WINDOW_NONE, cfg->dc == PRE_DC_TRACK);
+}
@@ -0,0 +1,60 @@
+/// @file preproc.h
+/// @brief Variable/Function Declarations - Fused DC removal, I/Q correction and windowing of a chirp
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/// Window table size, the tables of preproc_window.c are generated for it
+#define PRE_WINDOW_POINTS       1024U
+
+/// Windows with a table in preproc_window.c
+#define PRE_WINDOWS             2U
+
+/// Q14 value of an I/Q correction coefficient of pre_config_t
+#define PRE_Q14(x)              ((int16_t)(((x) * 16384.0) + (((x) < 0) ? -0.5 : 0.5)))
+
+extern const int16_t pre_window[PRE_WINDOWS][PRE_WINDOW_POINTS];
+
+/*
+ * DC removal
+ */
+typedef enum {
+    PRE_DC_NONE = 0,        ///< No DC removal
+    PRE_DC_CHIRP,           ///< Mean of the chirp itself, a read-only summing pass ahead of the fused pass
+    PRE_DC_TRACK            ///< Mean of the previous chirp, summed by the fused pass, single pass over the buffer
+} pre_dc_t;
+
+/*
+ * Window, the table index is the value minus one
+ */
+typedef enum {
+    PRE_WINDOW_NONE = 0,    ///< Rectangular
+    PRE_WINDOW_HANN,        ///< Periodic Hann
+    PRE_WINDOW_BLACKMAN     ///< Periodic Blackman
+} pre_window_t;
+
+/*
+ * Preprocessing of a chirp ahead of the range FFT
+ *
+ * Channel B is modelled as B = g * (Q * cos(phi) + I * sin(phi)) with I = channel A, the
+ * corrected Q is B / (g * cos(phi)) - I * tan(phi)
+ */
+typedef struct {
+    pre_dc_t     dc;        ///< DC removal
+    bool         iq;        ///< I/Q gain and phase correction of channel B
+    int16_t      iq_gain;   ///< PRE_Q14(1 / (g * cos(phi))), weight of channel B in the corrected Q
+    int16_t      iq_phase;  ///< PRE_Q14(-tan(phi)), weight of channel A in the corrected Q
+    pre_window_t window;    ///< Window
+} pre_config_t;
+
+/*
+ * Function declarations
+ */
+bool pre_supported(const pre_config_t *cfg, uint32_t n);
+void pre_reset(void);
+void pre_to_q15(void *buf, uint32_t n, const pre_config_t *cfg);
+void pre_q15(void *buf, uint32_t n, const pre_config_t *cfg);
@@ -0,0 +1,122 @@
+/// @file preproc_bench.c
+/// @brief Chirp preprocessing cycle count benchmark
+///
+/// Compares the fused pass of preproc.c with the same steps as separate loops over the
+/// chirp - conversion, mean, DC removal, I/Q correction and Hann window - at 256, 512
+/// and 1024 sample pairs, averaged over PRE_BENCH_ROUNDS runs. The fused pass is timed
+/// with the mean of the chirp and with the tracked mean of the previous chirp. The
+/// chirp is refilled outside the timed region.
+///
+/// @author Peter Ludlow
+
+#include "ch.h"
+#include "hal.h"
+#include "chprintf.h"
+#include "fft.h"
+#include "adc_capture.h"
+#include "preproc.h"
+#include "preproc_bench.h"
+#include "dsp_simd.h"
+#include "timing_probe.h"
+
+static adc_sample_t bench_chirp[PRE_WINDOW_POINTS];
+
+static const uint32_t bench_sizes[PRE_BENCH_SIZES] = { 256U, 512U, 1024U };
+
+static pre_config_t bench_pre = {
+        .dc = PRE_DC_CHIRP, .iq = true, .iq_gain = PRE_Q14(0.95), .iq_phase = PRE_Q14(-0.03), .window = PRE_WINDOW_HANN
+};
+
+
+/*
+ *@brief  The preprocessing as separate passes - conversion, mean, DC removal, I/Q correction and window
+ */
+
+static void bench_pre_naive(adc_sample_t *buf, uint32_t n, const pre_config_t *cfg){
+
+    cq15_t *x = (cq15_t *)buf;
+    const int16_t *win = pre_window[cfg->window - 1U];
+    uint32_t stride = PRE_WINDOW_POINTS / n;
+    int32_t sa = 0;
+    int32_t sb = 0;
+    uint32_t i;
+
+    adc_capture_to_q15(buf, n);
+
+    for (i = 0U; i < n; i++) {
+        sa += x[i].re;
+        sb += x[i].im;
+    }
+    sa /= (int32_t)n;
+    sb /= (int32_t)n;
+
+    for (i = 0U; i < n; i++) {
+        x[i].re = (int16_t)dsp_sat16(x[i].re - sa);
+        x[i].im = (int16_t)dsp_sat16(x[i].im - sb);
+    }
+
+    for (i = 0U; i < n; i++) {
+        x[i].im = (int16_t)dsp_sat16(((x[i].im * cfg->iq_gain) + (x[i].re * cfg->iq_phase)) >> 14);
+    }
+
+    for (i = 0U; i < n; i++) {
+        x[i].re = (int16_t)(((x[i].re * win[i * stride]) + 0x4000) >> 15);
+        x[i].im = (int16_t)(((x[i].im * win[i * stride]) + 0x4000) >> 15);
+    }
+}
+
+/*
+ *@brief  Measures the cycles per chirp of the separate and the fused preprocessing at every size
+ */
+
+void pre_benchmark(pre_bench_t results[PRE_BENCH_SIZES]){
+
+    uint32_t s, r, n;
+    rtcnt_t t;
+    uint32_t sum[3];
+
+    for (s = 0U; s < PRE_BENCH_SIZES; s++) {
+        n = bench_sizes[s];
+        sum[0] = sum[1] = sum[2] = 0U;
+
+        for (r = 0U; r < PRE_BENCH_ROUNDS; r++) {
+            adc_capture_fill_test_chirp(bench_chirp, n, r);
+            t = TIMING_PROBE_NOW();
+            bench_pre_naive(bench_chirp, n, &bench_pre);
+            sum[0] += TIMING_PROBE_NOW() - t;
+
+            bench_pre.dc = PRE_DC_CHIRP;
+            adc_capture_fill_test_chirp(bench_chirp, n, r);
+            t = TIMING_PROBE_NOW();
+            pre_to_q15(bench_chirp, n, &bench_pre);
+            sum[1] += TIMING_PROBE_NOW() - t;
+
+            bench_pre.dc = PRE_DC_TRACK;
+            adc_capture_fill_test_chirp(bench_chirp, n, r);
+            t = TIMING_PROBE_NOW();
+            pre_to_q15(bench_chirp, n, &bench_pre);
+            sum[2] += TIMING_PROBE_NOW() - t;
+            bench_pre.dc = PRE_DC_CHIRP;
+        }
+
+        results[s].n     = n;
+        results[s].naive = sum[0] / PRE_BENCH_ROUNDS;
+        results[s].fused = sum[1] / PRE_BENCH_ROUNDS;
+        results[s].track = sum[2] / PRE_BENCH_ROUNDS;
+    }
+}
+
+/*
+ *@brief  Prints the preprocessing benchmark results, one line per size
+ */
+
+void pre_benchmark_report(BaseSequentialStream *chp, const pre_bench_t results[PRE_BENCH_SIZES]){
+
+    uint32_t s;
+
+    chprintf(chp, "Preprocessing cycles per chirp, DC, I/Q and Hann window\r\n");
+    chprintf(chp, "     n     naive     fused     track\r\n");
+    for (s = 0U; s < PRE_BENCH_SIZES; s++) {
+        chprintf(chp, "  %4u %9u %9u %9u\r\n", results[s].n, results[s].naive, results[s].fused, results[s].track);
+    }
+}
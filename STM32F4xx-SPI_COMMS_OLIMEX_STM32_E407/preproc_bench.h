@@ -0,0 +1,31 @@
+/// @file preproc_bench.h
+/// @brief Variable/Function Declarations - Chirp preprocessing cycle count benchmark
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+#include "hal.h"
+
+/// Chirp sizes benchmarked, 256/512/1024 sample pairs
+#define PRE_BENCH_SIZES         3U
+
+/// Runs averaged per size
+#define PRE_BENCH_ROUNDS        8U
+
+/*
+ * Cycles per chirp preprocessing of one size, DC removal, I/Q correction and Hann window
+ */
+typedef struct {
+    uint32_t n;             ///< Sample pairs
+    uint32_t naive;         ///< Separate conversion, DC, I/Q and window passes
+    uint32_t fused;         ///< pre_to_q15(), mean of the chirp
+    uint32_t track;         ///< pre_to_q15(), mean of the previous chirp
+} pre_bench_t;
+
+/*
+ * Function declarations
+ */
+void pre_benchmark(pre_bench_t results[PRE_BENCH_SIZES]);
+void pre_benchmark_report(BaseSequentialStream *chp, const pre_bench_t results[PRE_BENCH_SIZES]);
@@ -0,0 +1,191 @@
+/// @file preproc_window.c
+/// @brief Chirp preprocessing window tables, generated by preproc_window.py - do not edit
+///
+/// @author Peter Ludlow
+
+#include <stdint.h>
+#include "preproc.h"
+
+#if (PRE_WINDOW_POINTS != 1024) || (PRE_WINDOWS != 2)
+#error "preproc_window.c out of date, regenerate with preproc_window.py"
+#endif
+
+/// Q15 periodic windows, Hann, Blackman
+const int16_t pre_window[PRE_WINDOWS][PRE_WINDOW_POINTS] = {
+    {   // Hann
+            0,     0,     1,     3,     5,     8,    11,    15,    20,    25,    31,    37,
+           44,    52,    60,    69,    79,    89,   100,   111,   123,   136,   149,   163,
+          177,   192,   208,   224,   241,   259,   277,   296,   315,   335,   355,   376,
+          398,   420,   443,   467,   491,   516,   541,   567,   593,   621,   648,   677,
+          705,   735,   765,   796,   827,   859,   891,   924,   958,   992,  1027,  1062,
+         1098,  1134,  1171,  1209,  1247,  1286,  1325,  1365,  1406,  1447,  1488,  1530,
+         1573,  1616,  1660,  1704,  1749,  1795,  1841,  1887,  1935,  1982,  2030,  2079,
+         2128,  2178,  2229,  2280,  2331,  2383,  2435,  2488,  2542,  2596,  2651,  2706,
+         2761,  2817,  2874,  2931,  2989,  3047,  3105,  3165,  3224,  3284,  3345,  3406,
+         3468,  3530,  3592,  3655,  3719,  3783,  3847,  3912,  3978,  4044,  4110,  4177,
+         4244,  4312,  4380,  4449,  4518,  4587,  4657,  4728,  4799,  4870,  4942,  5014,
+         5087,  5160,  5233,  5307,  5381,  5456,  5531,  5606,  5682,  5759,  5835,  5913,
+         5990,  6068,  6146,  6225,  6304,  6383,  6463,  6543,  6624,  6705,  6786,  6868,
+         6950,  7032,  7115,  7198,  7282,  7365,  7449,  7534,  7619,  7704,  7789,  7875,
+         7961,  8047,  8134,  8221,  8308,  8396,  8484,  8572,  8661,  8749,  8839,  8928,
+         9018,  9108,  9198,  9288,  9379,  9470,  9561,  9653,  9745,  9837,  9929, 10021,
+        10114, 10207, 10300, 10394, 10487, 10581, 10676, 10770, 10864, 10959, 11054, 11149,
+        11245, 11340, 11436, 11532, 11628, 11724, 11821, 11917, 12014, 12111, 12208, 12306,
+        12403, 12501, 12598, 12696, 12794, 12892, 12991, 13089, 13188, 13286, 13385, 13484,
+        13583, 13682, 13781, 13881, 13980, 14079, 14179, 14279, 14378, 14478, 14578, 14678,
+        14778, 14878, 14978, 15078, 15179, 15279, 15379, 15480, 15580, 15680, 15781, 15881,
+        15982, 16082, 16183, 16283, 16384, 16485, 16585, 16686, 16786, 16887, 16987, 17088,
+        17188, 17288, 17389, 17489, 17589, 17690, 17790, 17890, 17990, 18090, 18190, 18290,
+        18390, 18489, 18589, 18689, 18788, 18887, 18987, 19086, 19185, 19284, 19383, 19482,
+        19580, 19679, 19777, 19876, 19974, 20072, 20170, 20267, 20365, 20462, 20560, 20657,
+        20754, 20851, 20947, 21044, 21140, 21236, 21332, 21428, 21523, 21619, 21714, 21809,
+        21904, 21998, 22092, 22187, 22281, 22374, 22468, 22561, 22654, 22747, 22839, 22931,
+        23023, 23115, 23207, 23298, 23389, 23480, 23570, 23660, 23750, 23840, 23929, 24019,
+        24107, 24196, 24284, 24372, 24460, 24547, 24634, 24721, 24807, 24893, 24979, 25064,
+        25149, 25234, 25319, 25403, 25486, 25570, 25653, 25736, 25818, 25900, 25982, 26063,
+        26144, 26225, 26305, 26385, 26464, 26543, 26622, 26700, 26778, 26855, 26933, 27009,
+        27086, 27162, 27237, 27312, 27387, 27461, 27535, 27608, 27681, 27754, 27826, 27898,
+        27969, 28040, 28111, 28181, 28250, 28319, 28388, 28456, 28524, 28591, 28658, 28724,
+        28790, 28856, 28921, 28985, 29049, 29113, 29176, 29238, 29300, 29362, 29423, 29484,
+        29544, 29603, 29663, 29721, 29779, 29837, 29894, 29951, 30007, 30062, 30117, 30172,
+        30226, 30280, 30333, 30385, 30437, 30488, 30539, 30590, 30640, 30689, 30738, 30786,
+        30833, 30881, 30927, 30973, 31019, 31064, 31108, 31152, 31195, 31238, 31280, 31321,
+        31362, 31403, 31443, 31482, 31521, 31559, 31597, 31634, 31670, 31706, 31741, 31776,
+        31810, 31844, 31877, 31909, 31941, 31972, 32003, 32033, 32063, 32091, 32120, 32147,
+        32175, 32201, 32227, 32252, 32277, 32301, 32325, 32348, 32370, 32392, 32413, 32433,
+        32453, 32472, 32491, 32509, 32527, 32544, 32560, 32576, 32591, 32605, 32619, 32632,
+        32645, 32657, 32668, 32679, 32689, 32699, 32708, 32716, 32724, 32731, 32737, 32743,
+        32748, 32753, 32757, 32760, 32763, 32765, 32767, 32767, 32767, 32767, 32767, 32765,
+        32763, 32760, 32757, 32753, 32748, 32743, 32737, 32731, 32724, 32716, 32708, 32699,
+        32689, 32679, 32668, 32657, 32645, 32632, 32619, 32605, 32591, 32576, 32560, 32544,
+        32527, 32509, 32491, 32472, 32453, 32433, 32413, 32392, 32370, 32348, 32325, 32301,
+        32277, 32252, 32227, 32201, 32175, 32147, 32120, 32091, 32063, 32033, 32003, 31972,
+        31941, 31909, 31877, 31844, 31810, 31776, 31741, 31706, 31670, 31634, 31597, 31559,
+        31521, 31482, 31443, 31403, 31362, 31321, 31280, 31238, 31195, 31152, 31108, 31064,
+        31019, 30973, 30927, 30881, 30833, 30786, 30738, 30689, 30640, 30590, 30539, 30488,
+        30437, 30385, 30333, 30280, 30226, 30172, 30117, 30062, 30007, 29951, 29894, 29837,
+        29779, 29721, 29663, 29603, 29544, 29484, 29423, 29362, 29300, 29238, 29176, 29113,
+        29049, 28985, 28921, 28856, 28790, 28724, 28658, 28591, 28524, 28456, 28388, 28319,
+        28250, 28181, 28111, 28040, 27969, 27898, 27826, 27754, 27681, 27608, 27535, 27461,
+        27387, 27312, 27237, 27162, 27086, 27009, 26933, 26855, 26778, 26700, 26622, 26543,
+        26464, 26385, 26305, 26225, 26144, 26063, 25982, 25900, 25818, 25736, 25653, 25570,
+        25486, 25403, 25319, 25234, 25149, 25064, 24979, 24893, 24807, 24721, 24634, 24547,
+        24460, 24372, 24284, 24196, 24107, 24019, 23929, 23840, 23750, 23660, 23570, 23480,
+        23389, 23298, 23207, 23115, 23023, 22931, 22839, 22747, 22654, 22561, 22468, 22374,
+        22281, 22187, 22092, 21998, 21904, 21809, 21714, 21619, 21523, 21428, 21332, 21236,
+        21140, 21044, 20947, 20851, 20754, 20657, 20560, 20462, 20365, 20267, 20170, 20072,
+        19974, 19876, 19777, 19679, 19580, 19482, 19383, 19284, 19185, 19086, 18987, 18887,
+        18788, 18689, 18589, 18489, 18390, 18290, 18190, 18090, 17990, 17890, 17790, 17690,
+        17589, 17489, 17389, 17288, 17188, 17088, 16987, 16887, 16786, 16686, 16585, 16485,
+        16384, 16283, 16183, 16082, 15982, 15881, 15781, 15680, 15580, 15480, 15379, 15279,
+        15179, 15078, 14978, 14878, 14778, 14678, 14578, 14478, 14378, 14279, 14179, 14079,
+        13980, 13881, 13781, 13682, 13583, 13484, 13385, 13286, 13188, 13089, 12991, 12892,
+        12794, 12696, 12598, 12501, 12403, 12306, 12208, 12111, 12014, 11917, 11821, 11724,
+        11628, 11532, 11436, 11340, 11245, 11149, 11054, 10959, 10864, 10770, 10676, 10581,
+        10487, 10394, 10300, 10207, 10114, 10021,  9929,  9837,  9745,  9653,  9561,  9470,
+         9379,  9288,  9198,  9108,  9018,  8928,  8839,  8749,  8661,  8572,  8484,  8396,
+         8308,  8221,  8134,  8047,  7961,  7875,  7789,  7704,  7619,  7534,  7449,  7365,
+         7282,  7198,  7115,  7032,  6950,  6868,  6786,  6705,  6624,  6543,  6463,  6383,
+         6304,  6225,  6146,  6068,  5990,  5913,  5835,  5759,  5682,  5606,  5531,  5456,
+         5381,  5307,  5233,  5160,  5087,  5014,  4942,  4870,  4799,  4728,  4657,  4587,
+         4518,  4449,  4380,  4312,  4244,  4177,  4110,  4044,  3978,  3912,  3847,  3783,
+         3719,  3655,  3592,  3530,  3468,  3406,  3345,  3284,  3224,  3165,  3105,  3047,
+         2989,  2931,  2874,  2817,  2761,  2706,  2651,  2596,  2542,  2488,  2435,  2383,
+         2331,  2280,  2229,  2178,  2128,  2079,  2030,  1982,  1935,  1887,  1841,  1795,
+         1749,  1704,  1660,  1616,  1573,  1530,  1488,  1447,  1406,  1365,  1325,  1286,
+         1247,  1209,  1171,  1134,  1098,  1062,  1027,   992,   958,   924,   891,   859,
+          827,   796,   765,   735,   705,   677,   648,   621,   593,   567,   541,   516,
+          491,   467,   443,   420,   398,   376,   355,   335,   315,   296,   277,   259,
+          241,   224,   208,   192,   177,   163,   149,   136,   123,   111,   100,    89,
+           79,    69,    60,    52,    44,    37,    31,    25,    20,    15,    11,     8,
+            5,     3,     1,     0,
+    },
+    {   // Blackman
+            0,     0,     0,     1,     2,     3,     4,     5,     7,     9,    11,    13,
+           16,    19,    22,    25,    29,    32,    36,    40,    45,    49,    54,    59,
+           64,    70,    76,    82,    88,    94,   101,   108,   115,   123,   130,   138,
+          146,   155,   163,   172,   181,   191,   200,   210,   221,   231,   242,   253,
+          264,   275,   287,   299,   311,   324,   336,   349,   363,   376,   390,   404,
+          419,   433,   448,   464,   479,   495,   511,   528,   545,   562,   579,   597,
+          615,   633,   651,   670,   690,   709,   729,   749,   770,   790,   811,   833,
+          855,   877,   899,   922,   945,   969,   993,  1017,  1041,  1066,  1091,  1117,
+         1143,  1169,  1196,  1223,  1250,  1278,  1306,  1335,  1364,  1393,  1423,  1453,
+         1483,  1514,  1545,  1577,  1609,  1641,  1674,  1707,  1741,  1775,  1810,  1844,
+         1880,  1915,  1952,  1988,  2025,  2063,  2100,  2139,  2177,  2216,  2256,  2296,
+         2336,  2377,  2419,  2461,  2503,  2545,  2589,  2632,  2676,  2721,  2766,  2811,
+         2857,  2904,  2951,  2998,  3046,  3094,  3143,  3192,  3242,  3292,  3343,  3394,
+         3445,  3498,  3550,  3603,  3657,  3711,  3766,  3821,  3876,  3932,  3989,  4046,
+         4104,  4162,  4220,  4280,  4339,  4399,  4460,  4521,  4583,  4645,  4708,  4771,
+         4835,  4899,  4963,  5029,  5094,  5161,  5228,  5295,  5363,  5431,  5500,  5569,
+         5639,  5709,  5780,  5852,  5924,  5996,  6069,  6143,  6217,  6291,  6366,  6442,
+         6518,  6594,  6671,  6749,  6827,  6905,  6985,  7064,  7144,  7225,  7306,  7388,
+         7470,  7552,  7635,  7719,  7803,  7888,  7973,  8058,  8144,  8231,  8318,  8405,
+         8493,  8582,  8671,  8760,  8850,  8940,  9031,  9122,  9214,  9306,  9399,  9492,
+         9586,  9680,  9774,  9869,  9964, 10060, 10156, 10253, 10350, 10447, 10545, 10643,
+        10742, 10841, 10941, 11041, 11141, 11242, 11343, 11444, 11546, 11649, 11751, 11854,
+        11958, 12061, 12166, 12270, 12375, 12480, 12585, 12691, 12797, 12904, 13011, 13118,
+        13225, 13333, 13441, 13549, 13658, 13767, 13876, 13986, 14095, 14205, 14316, 14426,
+        14537, 14648, 14759, 14871, 14983, 15095, 15207, 15319, 15432, 15544, 15657, 15771,
+        15884, 15997, 16111, 16225, 16339, 16453, 16567, 16682, 16796, 16911, 17026, 17141,
+        17256, 17371, 17486, 17601, 17717, 17832, 17948, 18063, 18179, 18294, 18410, 18526,
+        18642, 18757, 18873, 18989, 19105, 19220, 19336, 19452, 19567, 19683, 19799, 19914,
+        20030, 20145, 20260, 20375, 20491, 20606, 20720, 20835, 20950, 21064, 21179, 21293,
+        21407, 21521, 21635, 21748, 21862, 21975, 22088, 22201, 22313, 22426, 22538, 22650,
+        22762, 22873, 22984, 23095, 23206, 23316, 23426, 23536, 23645, 23754, 23863, 23971,
+        24079, 24187, 24295, 24402, 24508, 24615, 24721, 24826, 24931, 25036, 25140, 25244,
+        25348, 25451, 25553, 25656, 25757, 25858, 25959, 26059, 26159, 26259, 26357, 26456,
+        26553, 26651, 26747, 26843, 26939, 27034, 27129, 27222, 27316, 27409, 27501, 27592,
+        27683, 27774, 27863, 27953, 28041, 28129, 28216, 28303, 28389, 28474, 28558, 28642,
+        28725, 28808, 28890, 28971, 29051, 29131, 29210, 29288, 29366, 29443, 29519, 29594,
+        29668, 29742, 29815, 29887, 29959, 30029, 30099, 30168, 30237, 30304, 30371, 30436,
+        30501, 30566, 30629, 30691, 30753, 30814, 30874, 30933, 30991, 31048, 31105, 31160,
+        31215, 31269, 31322, 31374, 31425, 31475, 31525, 31573, 31621, 31667, 31713, 31758,
+        31802, 31844, 31886, 31927, 31967, 32007, 32045, 32082, 32118, 32154, 32188, 32221,
+        32254, 32285, 32316, 32345, 32374, 32401, 32428, 32453, 32478, 32501, 32524, 32546,
+        32566, 32586, 32604, 32622, 32639, 32654, 32669, 32683, 32695, 32707, 32717, 32727,
+        32736, 32743, 32750, 32755, 32760, 32763, 32766, 32767, 32767, 32767, 32766, 32763,
+        32760, 32755, 32750, 32743, 32736, 32727, 32717, 32707, 32695, 32683, 32669, 32654,
+        32639, 32622, 32604, 32586, 32566, 32546, 32524, 32501, 32478, 32453, 32428, 32401,
+        32374, 32345, 32316, 32285, 32254, 32221, 32188, 32154, 32118, 32082, 32045, 32007,
+        31967, 31927, 31886, 31844, 31802, 31758, 31713, 31667, 31621, 31573, 31525, 31475,
+        31425, 31374, 31322, 31269, 31215, 31160, 31105, 31048, 30991, 30933, 30874, 30814,
+        30753, 30691, 30629, 30566, 30501, 30436, 30371, 30304, 30237, 30168, 30099, 30029,
+        29959, 29887, 29815, 29742, 29668, 29594, 29519, 29443, 29366, 29288, 29210, 29131,
+        29051, 28971, 28890, 28808, 28725, 28642, 28558, 28474, 28389, 28303, 28216, 28129,
+        28041, 27953, 27863, 27774, 27683, 27592, 27501, 27409, 27316, 27222, 27129, 27034,
+        26939, 26843, 26747, 26651, 26553, 26456, 26357, 26259, 26159, 26059, 25959, 25858,
+        25757, 25656, 25553, 25451, 25348, 25244, 25140, 25036, 24931, 24826, 24721, 24615,
+        24508, 24402, 24295, 24187, 24079, 23971, 23863, 23754, 23645, 23536, 23426, 23316,
+        23206, 23095, 22984, 22873, 22762, 22650, 22538, 22426, 22313, 22201, 22088, 21975,
+        21862, 21748, 21635, 21521, 21407, 21293, 21179, 21064, 20950, 20835, 20720, 20606,
+        20491, 20375, 20260, 20145, 20030, 19914, 19799, 19683, 19567, 19452, 19336, 19220,
+        19105, 18989, 18873, 18757, 18642, 18526, 18410, 18294, 18179, 18063, 17948, 17832,
+        17717, 17601, 17486, 17371, 17256, 17141, 17026, 16911, 16796, 16682, 16567, 16453,
+        16339, 16225, 16111, 15997, 15884, 15771, 15657, 15544, 15432, 15319, 15207, 15095,
+        14983, 14871, 14759, 14648, 14537, 14426, 14316, 14205, 14095, 13986, 13876, 13767,
+        13658, 13549, 13441, 13333, 13225, 13118, 13011, 12904, 12797, 12691, 12585, 12480,
+        12375, 12270, 12166, 12061, 11958, 11854, 11751, 11649, 11546, 11444, 11343, 11242,
+        11141, 11041, 10941, 10841, 10742, 10643, 10545, 10447, 10350, 10253, 10156, 10060,
+         9964,  9869,  9774,  9680,  9586,  9492,  9399,  9306,  9214,  9122,  9031,  8940,
+         8850,  8760,  8671,  8582,  8493,  8405,  8318,  8231,  8144,  8058,  7973,  7888,
+         7803,  7719,  7635,  7552,  7470,  7388,  7306,  7225,  7144,  7064,  6985,  6905,
+         6827,  6749,  6671,  6594,  6518,  6442,  6366,  6291,  6217,  6143,  6069,  5996,
+         5924,  5852,  5780,  5709,  5639,  5569,  5500,  5431,  5363,  5295,  5228,  5161,
+         5094,  5029,  4963,  4899,  4835,  4771,  4708,  4645,  4583,  4521,  4460,  4399,
+         4339,  4280,  4220,  4162,  4104,  4046,  3989,  3932,  3876,  3821,  3766,  3711,
+         3657,  3603,  3550,  3498,  3445,  3394,  3343,  3292,  3242,  3192,  3143,  3094,
+         3046,  2998,  2951,  2904,  2857,  2811,  2766,  2721,  2676,  2632,  2589,  2545,
+         2503,  2461,  2419,  2377,  2336,  2296,  2256,  2216,  2177,  2139,  2100,  2063,
+         2025,  1988,  1952,  1915,  1880,  1844,  1810,  1775,  1741,  1707,  1674,  1641,
+         1609,  1577,  1545,  1514,  1483,  1453,  1423,  1393,  1364,  1335,  1306,  1278,
+         1250,  1223,  1196,  1169,  1143,  1117,  1091,  1066,  1041,  1017,   993,   969,
+          945,   922,   899,   877,   855,   833,   811,   790,   770,   749,   729,   709,
+          690,   670,   651,   633,   615,   597,   579,   562,   545,   528,   511,   495,
+          479,   464,   448,   433,   419,   404,   390,   376,   363,   349,   336,   324,
+          311,   299,   287,   275,   264,   253,   242,   231,   221,   210,   200,   191,
+          181,   172,   163,   155,   146,   138,   130,   123,   115,   108,   101,    94,
+           88,    82,    76,    70,    64,    59,    54,    49,    45,    40,    36,    32,
+           29,    25,    22,    19,    16,    13,    11,     9,     7,     5,     4,     3,
+            2,     1,     0,     0,
+    },
+};
@@ -0,0 +1,55 @@
+#!/usr/bin/env python
+# Generates preproc_window.c, the window tables of the chirp preprocessing kept in flash
+#
+#   python preproc_window.py > preproc_window.c
+#
+# Periodic (DFT-even) Hann and Blackman windows of WINDOW_POINTS Q15 entries,
+# w[m] = sum a[k] cos(2*pi*k*m/N) with alternating signs. A periodic window of a
+# smaller size n is the table read with a stride of WINDOW_POINTS / n. The peak of 1.0
+# saturates to 32767.
+
+import math
+
+WINDOW_POINTS = 1024
+WINDOWS = [
+    ('Hann', [0.5, 0.5]),
+    ('Blackman', [0.42, 0.5, 0.08]),
+]
+
+
+def q15(v):
+    return max(-32768, min(32767, int(round(v * 32768.0))))
+
+
+def window(a, m):
+    return sum(((-1) ** k) * a[k] * math.cos(2.0 * math.pi * k * m / WINDOW_POINTS) for k in range(len(a)))
+
+
+def main():
+    out = []
+    out.append('/// @file preproc_window.c')
+    out.append('/// @brief Chirp preprocessing window tables, generated by preproc_window.py - do not edit')
+    out.append('///')
+    out.append('/// @author Peter Ludlow')
+    out.append('')
+    out.append('#include <stdint.h>')
+    out.append('#include "preproc.h"')
+    out.append('')
+    out.append('#if (PRE_WINDOW_POINTS != %d) || (PRE_WINDOWS != %d)' % (WINDOW_POINTS, len(WINDOWS)))
+    out.append('#error "preproc_window.c out of date, regenerate with preproc_window.py"')
+    out.append('#endif')
+    out.append('')
+    out.append('/// Q15 periodic windows, %s' % ', '.join(name for name, _ in WINDOWS))
+    out.append('const int16_t pre_window[PRE_WINDOWS][PRE_WINDOW_POINTS] = {')
+    for name, a in WINDOWS:
+        out.append('    {   // %s' % name)
+        for i in range(0, WINDOW_POINTS, 12):
+            out.append('        ' + ', '.join('%5d' % q15(window(a, m)) for m in range(i, min(i + 12, WINDOW_POINTS))) + ',')
+        out.append('    },')
+    out.append('};')
+
+    print('\n'.join(out))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,384 @@
+/// @file range_doppler.c
+/// @brief Range-Doppler map processing with the frame cube in CCM RAM
+///
+/// Each captured chirp is converted to Q15, optionally decimated (decim.c) and
+/// preprocessed (preproc.c), and range transformed in place in its acquisition buffer
+/// by the range thread, which then copies the kept range bins into one row of the
+/// frame cube and releases the buffer. The chirps of a frame fill the rows of the
+/// cube, [chirp][bin].
+///
+/// The Doppler FFT of a range bin runs down a column of the cube, a stride of one row
+/// per sample. After the last chirp of a frame the cube is corner turned into a second
+/// cube, [bin][chirp], in square blocks of RD_TRANSPOSE_BLOCK cells, so every Doppler
+/// FFT works on contiguous memory and the radix-4 passes keep their word strides. The
+/// Doppler thread then transforms the columns, takes the magnitudes and publishes the
+/// map while the range thread fills the row cube with the next frame. With a detector
+/// configured, the Doppler thread also runs CFAR over the map and publishes the
+/// detection list of the frame with it.
+///
+/// Both cubes live in the 64 KB CCM RAM, on the D-bus only: no wait states and no
+/// contention with the DCMI DMA writing the acquisition buffers in main SRAM. The DMA
+/// cannot reach the CCM, so the corner turn is a CPU copy.
+///
+/// A frame is dropped when the Doppler pass of the previous frame has not finished by
+/// the end of the next one, or when a chirp of the frame was lost by the capture.
+///
+/// @author Peter Ludlow
+
+#include <string.h>
+#include "ch.h"
+#include "hal.h"
+#include "range_doppler.h"
+#include "decim.h"
+#include "timing_probe.h"
+
+
+/*===============================================================*/
+/*Frame State                                                    */
+/*===============================================================*/
+
+// Range cube [chirp][bin] and Doppler cube [bin][chirp], CCM RAM
+static uint32_t rd_rows[RD_CUBE_CELLS] __attribute__((section(".ram4")));
+static uint32_t rd_cols[RD_CUBE_CELLS] __attribute__((section(".ram4")));
+
+// Magnitude map [bin][Doppler], main SRAM so it can be sent out by DMA
+static uint16_t rd_map[RD_CUBE_CELLS];
+
+// Detections of the last map
+static cfar_list_t rd_detections;
+
+static struct {
+    rd_config_t      cfg;
+    uint32_t         decim;         // Decimation, 1 for none
+    uint32_t         row;           // Next row of the range cube
+    uint32_t         next_chirp;    // Chirp number expected next from the capture
+    uint32_t         overruns;      // Capture overruns seen so far
+    adc_chirp_t      queue[2];      // Chirps waiting for the range thread, the capture holds at most two
+    uint32_t         head;
+    uint32_t         tail;
+    volatile bool    doppler_busy;  // Doppler cube in use by the Doppler thread
+    semaphore_t      pending;       // Counts the queued chirps
+    semaphore_t      frame;         // Signalled when the Doppler cube holds a new frame
+    bool             started;       // Threads created
+} rd;
+
+static EVENTSOURCE_DECL(rd_source);     // Broadcast RD_MAP_READY when the map is updated
+
+static rd_stats_t stats;
+
+static THD_WORKING_AREA(rd_range_wa, 512);
+static THD_WORKING_AREA(rd_doppler_wa, 512);
+
+
+/*===============================================================*/
+/*Processing Steps                                               */
+/*===============================================================*/
+
+/*
+ *@brief  Sets the frame geometry and restarts the frame, returns false if it is not supported
+ */
+
+bool rd_init(const rd_config_t *cfg){
+
+    uint32_t decim = (cfg->decim > 1U) ? cfg->decim : 1U;
+
+    if ((cfg->range_n < FFT_MIN_POINTS) || (cfg->range_n > FFT_MAX_POINTS) || ((cfg->range_n & (cfg->range_n - 1U)) != 0U) ||
+        ((decim > 1U) && !decim_supported(decim)) || ((cfg->range_n * decim) > ADC_CAPTURE_MAX_SAMPLES) ||
+        (cfg->chirps < FFT_MIN_POINTS) || (cfg->chirps > FFT_MAX_POINTS) || ((cfg->chirps & (cfg->chirps - 1U)) != 0U) ||
+        (cfg->bins == 0U) || (cfg->bins > cfg->range_n) || ((cfg->bins * cfg->chirps) > RD_CUBE_CELLS) ||
+        ((cfg->pre != NULL) && !pre_supported(cfg->pre, cfg->range_n))) {
+        return false;
+    }
+
+    rd.cfg = *cfg;
+    rd.decim = decim;
+    rd.row = 0U;
+    pre_reset();
+
+    return true;
+}
+
+/*
+ *@brief  Range pass of one chirp - Q15 conversion, decimation and preprocessing, and FFT in place, kept bins copied to the next row of the cube
+ *@note   Returns true when the chirp completed the frame, the row cube then holds the whole frame
+ */
+
+bool rd_range(adc_sample_t *buf){
+
+    cq15_t *x = (cq15_t *)buf;
+
+    if (rd.decim > 1U) {
+        (void) decim_to_q15(buf, rd.cfg.range_n * rd.decim, rd.decim);
+        if (rd.cfg.pre != NULL) {
+            pre_q15(buf, rd.cfg.range_n, rd.cfg.pre);
+        }
+    }
+    else if (rd.cfg.pre != NULL) {
+        pre_to_q15(buf, rd.cfg.range_n, rd.cfg.pre);
+    }
+    else {
+        adc_capture_to_q15(buf, rd.cfg.range_n);
+    }
+    (void) fft_cfft_q15(x, rd.cfg.range_n);
+
+    memcpy(&rd_rows[rd.row * rd.cfg.bins], x, rd.cfg.bins * sizeof(uint32_t));
+
+    if (++rd.row < rd.cfg.chirps) {
+        return false;
+    }
+
+    rd.row = 0U;
+    return true;
+}
+
+/*
+ *@brief  Transposes the row cube into the Doppler cube in RD_TRANSPOSE_BLOCK square blocks
+ *@note   The block reads RD_TRANSPOSE_BLOCK rows and writes RD_TRANSPOSE_BLOCK columns, the edge blocks are clipped
+ */
+
+void rd_corner_turn(void){
+
+    uint32_t chirps = rd.cfg.chirps;
+    uint32_t bins = rd.cfg.bins;
+    uint32_t r0, c0, r, c, r_end, c_end;
+    const uint32_t *src;
+    uint32_t *dst;
+
+    for (c0 = 0U; c0 < bins; c0 += RD_TRANSPOSE_BLOCK) {
+        c_end = ((c0 + RD_TRANSPOSE_BLOCK) < bins) ? (c0 + RD_TRANSPOSE_BLOCK) : bins;
+
+        for (r0 = 0U; r0 < chirps; r0 += RD_TRANSPOSE_BLOCK) {
+            r_end = ((r0 + RD_TRANSPOSE_BLOCK) < chirps) ? (r0 + RD_TRANSPOSE_BLOCK) : chirps;
+
+            for (c = c0; c < c_end; c++) {
+                src = &rd_rows[r0 * bins + c];
+                dst = &rd_cols[c * chirps + r0];
+                for (r = r0; r < r_end; r++) {
+                    *dst++ = *src;
+                    src += bins;
+                }
+            }
+        }
+    }
+}
+
+/*
+ *@brief  Doppler pass - FFT of every column of the Doppler cube and magnitude map, [bin][Doppler]
+ *@note   The Doppler axis is centred, zero velocity at index chirps / 2
+ */
+
+void rd_doppler(uint16_t *map){
+
+    uint32_t chirps = rd.cfg.chirps;
+    uint32_t half = chirps / 2U;
+    uint32_t b, k;
+    cq15_t *col;
+    uint16_t *out;
+
+    for (b = 0U; b < rd.cfg.bins; b++) {
+        col = (cq15_t *)&rd_cols[b * chirps];
+        out = &map[b * chirps];
+
+        (void) fft_cfft_q15(col, chirps);
+
+        for (k = 0U; k < half; k++) {
+            out[k + half] = fft_mag_q15(col[k]);
+            out[k] = fft_mag_q15(col[k + half]);
+        }
+    }
+}
+
+
+/*===============================================================*/
+/*Processing Threads                                             */
+/*===============================================================*/
+
+/*
+ *@brief  Chirp callback of the capture, queues the chirp for the range thread
+ *@note   A half handed out again while still queued has been overwritten, it is not queued twice
+ */
+
+static void rd_chirp_cb(const adc_chirp_t *chirp){
+
+    if ((rd.head - rd.tail) >= 2U) {
+        return;
+    }
+
+    rd.queue[rd.head++ & 1U] = *chirp;
+    chSemSignalI(&rd.pending);
+}
+
+/*
+ *@brief  Range thread, one range pass per chirp and the corner turn at the end of each frame
+ */
+
+static THD_FUNCTION(rd_range_thread, arg){
+
+    adc_chirp_t c;
+    rtcnt_t t;
+    uint32_t overruns;
+    bool full;
+
+    (void)arg;
+    chRegSetThreadName("rd_range");
+
+    while (true) {
+        if (chSemWait(&rd.pending) != MSG_OK) {
+            continue;
+        }
+
+        chSysLock();
+        c = rd.queue[rd.tail++ & 1U];
+        chSysUnlock();
+
+        // A chirp lost or overwritten in the capture breaks the frame, start over with the next chirp
+        overruns = adc_capture_get_stats()->overruns;
+        if ((c.chirp != rd.next_chirp) || (overruns != rd.overruns)) {
+            rd.next_chirp = c.chirp + 1U;
+            rd.overruns = overruns;
+            rd.row = 0U;
+            stats.dropped++;
+            adc_capture_release(c.buf);
+            continue;
+        }
+        rd.next_chirp = c.chirp + 1U;
+
+        t = TIMING_PROBE_NOW();
+        full = rd_range(c.buf);
+        adc_capture_release(c.buf);
+        stats.range_time = TIMING_PROBE_NOW() - t;
+
+        if (full) {
+            if (rd.doppler_busy) {
+                stats.dropped++;
+                continue;
+            }
+
+            t = TIMING_PROBE_NOW();
+            rd_corner_turn();
+            stats.turn_time = TIMING_PROBE_NOW() - t;
+
+            rd.doppler_busy = true;
+            chSemSignal(&rd.frame);
+        }
+    }
+}
+
+/*
+ *@brief  Doppler thread, one Doppler pass per frame
+ */
+
+static THD_FUNCTION(rd_doppler_thread, arg){
+
+    rtcnt_t t;
+
+    (void)arg;
+    chRegSetThreadName("rd_doppler");
+
+    while (true) {
+        if (chSemWait(&rd.frame) != MSG_OK) {
+            continue;
+        }
+
+        t = TIMING_PROBE_NOW();
+        rd_doppler(rd_map);
+        stats.doppler_time = TIMING_PROBE_NOW() - t;
+
+        if (rd.cfg.cfar != NULL) {
+            t = TIMING_PROBE_NOW();
+            (void) cfar_map(rd_map, rd.cfg.bins, rd.cfg.chirps, rd.cfg.cfar, &rd_detections);
+            stats.cfar_time = TIMING_PROBE_NOW() - t;
+        }
+        stats.frames++;
+
+        rd.doppler_busy = false;
+        chEvtBroadcastFlags(&rd_source, RD_MAP_READY);
+    }
+}
+
+/*
+ *@brief  Starts the capture and the range-Doppler processing, returns false if the geometry is not supported
+ *@note   The processing threads are created by the first call, a restart needs rd_stop() and the last map read
+ */
+
+bool rd_start(const rd_config_t *cfg){
+
+    static adc_capture_config_t capture_cfg;
+
+    if (!rd_init(cfg)) {
+        return false;
+    }
+
+    rd.head = 0U;
+    rd.tail = 0U;
+    rd.next_chirp = 0U;
+    rd.overruns = adc_capture_get_stats()->overruns;
+    rd.doppler_busy = false;
+
+    if (!rd.started) {
+        rd.started = true;
+        chSemObjectInit(&rd.pending, 0);
+        chSemObjectInit(&rd.frame, 0);
+        (void) chThdCreateStatic(rd_range_wa, sizeof(rd_range_wa), RD_RANGE_THREAD_PRIO, rd_range_thread, NULL);
+        (void) chThdCreateStatic(rd_doppler_wa, sizeof(rd_doppler_wa), RD_DOPPLER_THREAD_PRIO, rd_doppler_thread, NULL);
+    }
+    else {
+        chSemReset(&rd.pending, 0);
+        chSemReset(&rd.frame, 0);
+    }
+
+    capture_cfg.samples      = cfg->range_n * rd.decim;
+    capture_cfg.cb           = rd_chirp_cb;
+    capture_cfg.period_us    = cfg->period_us;
+    capture_cfg.ramp_trigger = cfg->ramp_trigger;
+    adc_capture_start(&capture_cfg);
+
+    return true;
+}
+
+/*
+ *@brief  Stops the capture, the map keeps the last frame
+ */
+
+void rd_stop(void){
+
+    adc_capture_stop();
+}
+
+/*
+ *@brief  Returns the magnitude map, [bin][Doppler], updated in place by every frame
+ *@note   Read it on RD_MAP_READY, it is rewritten by the Doppler pass of the next frame
+ */
+
+const uint16_t *rd_get_map(void){
+
+    return rd_map;
+}
+
+/*
+ *@brief  Returns the detection list of the last map, empty without a detector
+ *@note   Read it on RD_MAP_READY, it is rewritten with the map
+ */
+
+const cfar_list_t *rd_get_detections(void){
+
+    return &rd_detections;
+}
+
+/*
+ *@brief  Returns the event source broadcast with RD_MAP_READY after every map update
+ */
+
+event_source_t *rd_get_source(void){
+
+    return &rd_source;
+}
+
+/*
+ *@brief  Returns the processing statistics
+ */
+
+const rd_stats_t *rd_get_stats(void){
+
+    return &stats;
+}
@@ -0,0 +1,82 @@
+/// @file range_doppler.h
+/// @brief Variable/Function Declarations - Range-Doppler map processing with the frame cube in CCM RAM
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+#include "hal.h"
+#include "adc_capture.h"
+#include "fft.h"
+#include "cfar.h"
+#include "preproc.h"
+
+/// Complex range bins kept per frame (chirps * bins), one frame cube is 4 bytes per cell -
+/// the range (row) and Doppler (column) cubes fill the 64 KB CCM RAM at the default
+#if !defined(RD_CUBE_CELLS)
+#define RD_CUBE_CELLS           8192U
+#endif
+
+/// Corner turn block edge, cells - a block of rows and columns is copied before moving on
+#if !defined(RD_TRANSPOSE_BLOCK)
+#define RD_TRANSPOSE_BLOCK      8U
+#endif
+
+/// Priority of the range FFT thread, it must keep up with the chirps
+#if !defined(RD_RANGE_THREAD_PRIO)
+#define RD_RANGE_THREAD_PRIO    (NORMALPRIO + 1)
+#endif
+
+/// Priority of the Doppler FFT thread, it has a whole frame to finish
+#if !defined(RD_DOPPLER_THREAD_PRIO)
+#define RD_DOPPLER_THREAD_PRIO  NORMALPRIO
+#endif
+
+/// Event flag broadcast with the map ready event source
+#define RD_MAP_READY            1U
+
+/*
+ * Frame geometry
+ */
+typedef struct {
+    uint32_t             range_n;       ///< Range FFT size = sample pairs per chirp after decimation, power of two FFT_MIN_POINTS .. FFT_MAX_POINTS
+    uint32_t             decim;         ///< Decimation ahead of the range FFT, 0 or 1 for none, else DECIM_MIN .. DECIM_MAX
+    uint32_t             bins;          ///< Range bins kept from each chirp, the lowest beat frequencies
+    uint32_t             chirps;        ///< Chirps per frame = Doppler FFT size, power of two, at least FFT_MIN_POINTS
+    uint32_t             period_us;     ///< Chirp repetition period, capture simulator only
+    bool                 ramp_trigger;  ///< Capture on the ADF4159 ramp complete edges
+    const cfar_config_t *cfar;          ///< Detector run on every map, NULL for none
+    const pre_config_t  *pre;           ///< DC, I/Q and window preprocessing of each chirp, NULL for the plain Q15 conversion
+} rd_config_t;
+
+/*
+ * Processing statistics, times in TIMING_PROBE_FREQ counts
+ */
+typedef struct {
+    uint32_t frames;        ///< Range-Doppler maps produced
+    uint32_t dropped;       ///< Frames lost, the Doppler pass was still busy or a chirp was missed
+    rtcnt_t  range_time;    ///< Last range pass of one chirp, conversion and FFT and row copy
+    rtcnt_t  turn_time;     ///< Last corner turn
+    rtcnt_t  doppler_time;  ///< Last Doppler pass, FFTs and magnitudes
+    rtcnt_t  cfar_time;     ///< Last detection pass
+} rd_stats_t;
+
+/*
+ * Function declarations
+ */
+bool rd_start(const rd_config_t *cfg);
+void rd_stop(void);
+const uint16_t *rd_get_map(void);
+const cfar_list_t *rd_get_detections(void);
+event_source_t *rd_get_source(void);
+const rd_stats_t *rd_get_stats(void);
+
+/*
+ * Processing steps, called by the processing threads - exposed for the benchmark,
+ * which runs them directly before rd_start()
+ */
+bool rd_init(const rd_config_t *cfg);
+bool rd_range(adc_sample_t *buf);
+void rd_corner_turn(void);
+void rd_doppler(uint16_t *map);
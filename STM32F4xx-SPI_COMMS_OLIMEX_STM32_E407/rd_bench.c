@@ -0,0 +1,103 @@
+/// @file rd_bench.c
+/// @brief Range-Doppler frame cycle count benchmark
+///
+/// Runs the Q15 processing steps of range_doppler.c over whole frames of synthetic
+/// chirps, for several range FFT sizes and chirps per frame. The chirp buffer is
+/// refilled outside the timed region. It must run before rd_start(), the frame cube is
+/// shared with the processing threads. The frame time includes a CA-CFAR pass over the
+/// map, 2 x 8 training and 2 x 2 guard cells. Two geometries decimate 1024 captured
+/// sample pairs ahead of the range FFT.
+///
+/// @author Peter Ludlow
+
+#include "ch.h"
+#include "hal.h"
+#include "chprintf.h"
+#include "fft.h"
+#include "rd_bench.h"
+#include "range_doppler.h"
+#include "timing_probe.h"
+
+static adc_sample_t bench_chirp[ADC_CAPTURE_MAX_SAMPLES];
+static uint16_t bench_map[RD_CUBE_CELLS];
+
+static const cfar_config_t bench_cfar = {
+        .mode = CFAR_CA, .guard = 2U, .train = 8U, .scale = CFAR_SCALE(3.0), .peak = true
+};
+
+static cfar_list_t bench_detections;
+
+static const rd_config_t bench_frames[RD_BENCH_CONFIGS] = {
+        { .range_n = 128U, .bins = 64U,  .chirps = 16U },
+        { .range_n = 128U, .bins = 64U,  .chirps = 64U },
+        { .range_n = 256U, .bins = 128U, .chirps = 32U },
+        { .range_n = 256U, .bins = 128U, .chirps = 64U },
+        { .range_n = 512U, .bins = 256U, .chirps = 16U },
+        { .range_n = 512U, .bins = 256U, .chirps = 32U },
+        { .range_n = 256U, .decim = 4U, .bins = 128U, .chirps = 32U },
+        { .range_n = 128U, .decim = 8U, .bins = 64U,  .chirps = 64U }
+};
+
+
+/*
+ *@brief  Measures the cycles per range-Doppler frame of every benchmark geometry
+ */
+
+void rd_benchmark(rd_bench_t results[RD_BENCH_CONFIGS]){
+
+    uint32_t g, r;
+    const rd_config_t *cfg;
+    rtcnt_t t;
+    uint32_t range, decim;
+
+    for (g = 0U; g < RD_BENCH_CONFIGS; g++) {
+        cfg = &bench_frames[g];
+        decim = (cfg->decim > 1U) ? cfg->decim : 1U;
+        (void) rd_init(cfg);
+
+        range = 0U;
+        for (r = 0U; r < cfg->chirps; r++) {
+            adc_capture_fill_test_chirp(bench_chirp, cfg->range_n * decim, r);
+            t = TIMING_PROBE_NOW();
+            (void) rd_range(bench_chirp);
+            range += TIMING_PROBE_NOW() - t;
+        }
+
+        results[g].range_n = cfg->range_n;
+        results[g].decim   = decim;
+        results[g].bins    = cfg->bins;
+        results[g].chirps  = cfg->chirps;
+        results[g].range   = range;
+
+        t = TIMING_PROBE_NOW();
+        rd_corner_turn();
+        results[g].turn = TIMING_PROBE_NOW() - t;
+
+        t = TIMING_PROBE_NOW();
+        rd_doppler(bench_map);
+        results[g].doppler = TIMING_PROBE_NOW() - t;
+
+        t = TIMING_PROBE_NOW();
+        (void) cfar_map(bench_map, cfg->bins, cfg->chirps, &bench_cfar, &bench_detections);
+        results[g].cfar = TIMING_PROBE_NOW() - t;
+
+        results[g].frame = results[g].range + results[g].turn + results[g].doppler + results[g].cfar;
+    }
+}
+
+/*
+ *@brief  Prints the range-Doppler benchmark results, one line per geometry, with the frame rate the CPU alone allows
+ */
+
+void rd_benchmark_report(BaseSequentialStream *chp, const rd_bench_t results[RD_BENCH_CONFIGS]){
+
+    uint32_t g;
+
+    chprintf(chp, "Range-Doppler cycles per frame\r\n");
+    chprintf(chp, "  range_n decim  bins chirps     range      turn   doppler      cfar     frame  frames/s\r\n");
+    for (g = 0U; g < RD_BENCH_CONFIGS; g++) {
+        chprintf(chp, "  %7u %5u %5u %6u %9u %9u %9u %9u %9u %9u\r\n", results[g].range_n, results[g].decim, results[g].bins,
+                 results[g].chirps, results[g].range, results[g].turn, results[g].doppler, results[g].cfar, results[g].frame,
+                 TIMING_PROBE_FREQ / results[g].frame);
+    }
+}
@@ -0,0 +1,33 @@
+/// @file rd_bench.h
+/// @brief Variable/Function Declarations - Range-Doppler frame cycle count benchmark
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+#include "hal.h"
+
+/// Range-Doppler frame geometries benchmarked, range_n/bins/chirps/decimation
+#define RD_BENCH_CONFIGS        8U
+
+/*
+ * Cycles per range-Doppler frame of one geometry
+ */
+typedef struct {
+    uint32_t range_n;       ///< Range FFT size
+    uint32_t decim;         ///< Decimation ahead of the range FFT, 1 for none
+    uint32_t bins;          ///< Range bins kept
+    uint32_t chirps;        ///< Chirps per frame
+    uint32_t range;         ///< Range passes of the whole frame
+    uint32_t turn;          ///< Corner turn
+    uint32_t doppler;       ///< Doppler pass
+    uint32_t cfar;          ///< CA-CFAR over the map
+    uint32_t frame;         ///< Whole frame
+} rd_bench_t;
+
+/*
+ * Function declarations
+ */
+void rd_benchmark(rd_bench_t results[RD_BENCH_CONFIGS]);
+void rd_benchmark_report(BaseSequentialStream *chp, const rd_bench_t results[RD_BENCH_CONFIGS]);
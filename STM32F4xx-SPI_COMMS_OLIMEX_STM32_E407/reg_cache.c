@@ -0,0 +1,332 @@
+/// @file reg_cache.c
+/// @brief Shadow register cache with delta-only reprogramming
+///
+/// Every front end device has a shadow image of the register values it currently
+/// holds. Updates go to the shadow image and mark the changed registers dirty. A flush
+/// then writes only the dirty registers, in the order the datasheet requires (e.g.
+/// ADF4355 R0 last, which triggers the autocalibration). Double buffered registers
+/// pull in their latch register, so a frequency hop costs one or two register words
+/// rather than the complete table.
+///
+/// @author Peter Ludlow
+
+#include <string.h>
+#include "ch.h"
+#include "hal.h"
+#include "reg_cache.h"
+
+
+#define REG_BIT(n)      ((uint32_t)1U << (n))
+
+
+/*===============================================================*/
+/*Register Maps                                                  */
+/*===============================================================*/
+
+/*
+ *@brief  ADF4159 register index of a control word - address in DB2:DB0, double load select bits of R4/R5/R6
+ */
+
+static uint8_t ADF4159_decode(uint32_t word){
+
+    uint8_t reg = (uint8_t)(word & 0x7U);
+
+    if ((reg == 4U) && ((word & REG_BIT(6)) != 0U)) {
+        return ADF4159_REG4_SEL1;           // CLK DIV SEL = 1
+    }
+    if ((reg == 5U) && ((word & REG_BIT(23)) != 0U)) {
+        return ADF4159_REG5_SEL1;           // DEV SEL = 1
+    }
+    if ((reg == 6U) && ((word & REG_BIT(23)) != 0U)) {
+        return ADF4159_REG6_SEL1;           // STEP SEL = 1
+    }
+
+    return reg;
+}
+
+/*
+ *@brief  ADF4355 register index of a control word - address in DB3:DB0
+ */
+
+static uint8_t ADF4355_decode(uint32_t word){
+
+    uint8_t reg = (uint8_t)(word & 0xFU);
+
+    return (reg <= 12U) ? reg : REG_CACHE_NO_REG;
+}
+
+// ADF4159 - load registers from 7-0, registers 6/5/4 twice, R0 last (latches R1/R2)
+static const uint8_t ADF4159_order[] = {
+        7, 6, ADF4159_REG6_SEL1, 5, ADF4159_REG5_SEL1, 4, ADF4159_REG4_SEL1, 3, 2, 1, 0
+};
+
+// ADF4355 - load registers from 12-0, R0 last (latches R1/R2 and starts the autocalibration)
+static const uint8_t ADF4355_order[] = {
+        12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0
+};
+
+// ADA8282 - INTF_CONFA, LNA_OFFSET0/1, BIAS_SEL, PGA_GAIN, EN_CHAN, EN_BIAS_GEN
+static const uint16_t ADA8282_addr[] = {
+        0x00, 0x10, 0x11, 0x14, 0x15, 0x17, 0x18
+};
+
+static const uint8_t ADA8282_order[] = {
+        0, 1, 2, 3, 4, 5, 6
+};
+
+// AD9648 - device index, power modes, test mode, transfer (latches the channel registers)
+static const uint16_t AD9648_addr[] = {
+        0x05, 0x08, 0x0D, 0xFF
+};
+
+static const uint8_t AD9648_order[] = {
+        0, 1, 2, 3
+};
+
+static const reg_cache_map_t ADF4159_map = {
+        SPI_ADF4159, sizeof(ADF4159_order), ADF4159_order, NULL, ADF4159_decode,
+        REG_BIT(1) | REG_BIT(2), 0
+};
+
+static const reg_cache_map_t ADF4355_map = {
+        SPI_ADF4355, sizeof(ADF4355_order), ADF4355_order, NULL, ADF4355_decode,
+        REG_BIT(1) | REG_BIT(2), 0
+};
+
+static const reg_cache_map_t ADA8282_U404_map = {
+        SPI_ADA8282_U404, sizeof(ADA8282_order), ADA8282_order, ADA8282_addr, NULL,
+        0, 0
+};
+
+static const reg_cache_map_t ADA8282_U405_map = {
+        SPI_ADA8282_U405, sizeof(ADA8282_order), ADA8282_order, ADA8282_addr, NULL,
+        0, 0
+};
+
+static const reg_cache_map_t AD9648_map = {
+        SPI_AD9648, sizeof(AD9648_order), AD9648_order, AD9648_addr, NULL,
+        REG_BIT(1) | REG_BIT(2), 3
+};
+
+/*
+ * Shadow images, clean with no known register until a power-on table is synced or a register is set, a zero
+ * shadow is never written to or checked against the device. The AD9648 transfer register value is fixed
+ */
+
+reg_cache_t ADF4159_regs      = { .map = &ADF4159_map };
+reg_cache_t ADF4355_regs      = { .map = &ADF4355_map };
+reg_cache_t ADA8282_U404_regs = { .map = &ADA8282_U404_map };
+reg_cache_t ADA8282_U405_regs = { .map = &ADA8282_U405_map };
+reg_cache_t AD9648_regs       = { .map = &AD9648_map,       .known = REG_BIT(3), .shadow = {[3] = 0x01} };
+
+
+/*===============================================================*/
+/*Word Encoding                                                  */
+/*===============================================================*/
+
+/*
+ *@brief  Register index of a register word, REG_CACHE_NO_REG if the word is not cached
+ */
+
+static uint8_t word_decode(const reg_cache_map_t *map, const uint8_t *w, uint8_t size, uint32_t *value){
+
+    uint16_t addr;
+    uint8_t i;
+
+    if (map->addr == NULL) {
+        *value = ((uint32_t)w[0] << 24) | ((uint32_t)w[1] << 16) | ((uint32_t)w[2] << 8) | w[3];
+        return map->decode(*value);
+    }
+
+    // Address/data word - R/W + A14:A8, A7:A0, D7:D0, read instructions do not change the device
+    if ((w[0] & 0x80U) != 0U) {
+        return REG_CACHE_NO_REG;
+    }
+    addr = (uint16_t)(((w[0] & 0x7FU) << 8) | w[1]);
+    *value = w[size - 1U];
+    for (i = 0; i < map->nregs; i++) {
+        if (map->addr[i] == addr) {
+            return i;
+        }
+    }
+
+    return REG_CACHE_NO_REG;
+}
+
+/*
+ *@brief  Formats the register word of a register index
+ */
+
+static void word_encode(const reg_cache_map_t *map, uint8_t reg, uint32_t value, uint8_t *w){
+
+    if (map->addr == NULL) {
+        w[0] = (uint8_t)(value >> 24);
+        w[1] = (uint8_t)(value >> 16);
+        w[2] = (uint8_t)(value >> 8);
+        w[3] = (uint8_t)value;
+        return;
+    }
+
+    w[0] = (uint8_t)((map->addr[reg] >> 8) & 0x7FU);     // Write
+    w[1] = (uint8_t)map->addr[reg];
+    w[2] = (uint8_t)value;
+}
+
+
+/*===============================================================*/
+/*Cache API                                                      */
+/*===============================================================*/
+
+/*
+ *@brief  Records register words that have been written to the device by other means, e.g. a power-on table
+ */
+
+void reg_cache_sync(reg_cache_t *cache, const uint8_t *words, uint8_t count){
+
+    uint8_t size = spi_profile_get(cache->map->dev->id)->word_size;
+    uint32_t value;
+    uint8_t reg;
+
+    while (count-- > 0U) {
+        reg = word_decode(cache->map, words, size, &value);
+        if (reg != REG_CACHE_NO_REG) {
+            cache->shadow[reg] = value;
+            cache->known |= REG_BIT(reg);
+            cache->dirty &= ~REG_BIT(reg);
+        }
+        words += size;
+    }
+}
+
+/*
+ *@brief  Updates a register in the shadow image, it is marked dirty only if its value changes or was not known
+ */
+
+void reg_cache_set(reg_cache_t *cache, uint8_t reg, uint32_t value){
+
+    osalDbgCheck(reg < cache->map->nregs);
+
+    if ((cache->shadow[reg] != value) || ((cache->known & REG_BIT(reg)) == 0U)) {
+        cache->shadow[reg] = value;
+        cache->known |= REG_BIT(reg);
+        cache->dirty |= REG_BIT(reg);
+    }
+}
+
+/*
+ *@brief  Updates the bits of mask in a register of the shadow image
+ *@note   The other bits keep their shadow value, zero if the register is not known yet
+ */
+
+void reg_cache_set_field(reg_cache_t *cache, uint8_t reg, uint32_t mask, uint32_t value){
+
+    osalDbgCheck(reg < cache->map->nregs);
+
+    reg_cache_set(cache, reg, (cache->shadow[reg] & ~mask) | (value & mask));
+}
+
+/*
+ *@brief  Returns a register value of the shadow image, for diagnostics
+ */
+
+uint32_t reg_cache_get(const reg_cache_t *cache, uint8_t reg){
+
+    osalDbgCheck(reg < cache->map->nregs);
+
+    return cache->shadow[reg];
+}
+
+/*
+ *@brief  Marks every known register dirty, e.g. after the device has been power cycled or reset
+ *@note   The next flush writes the intended values back, registers never synced or set keep the device default
+ */
+
+void reg_cache_invalidate(reg_cache_t *cache){
+
+    cache->dirty = cache->known;
+}
+
+/*
+ *@brief  Formats the dirty registers in datasheet order into a sequence descriptor and marks them clean
+ *@note   Returns the number of register words, the descriptor is valid until the next build
+ */
+
+uint8_t reg_cache_build(reg_cache_t *cache, spi_sequence_t *seq){
+
+    const reg_cache_map_t *map = cache->map;
+    uint8_t size = spi_profile_get(map->dev->id)->word_size;
+    uint32_t write = cache->dirty;
+    uint8_t i, reg, n = 0;
+
+    if ((write & map->latch_from) != 0U) {
+        osalDbgAssert((cache->known & REG_BIT(map->latch_reg)) != 0U, "latch register not known");
+        write |= REG_BIT(map->latch_reg);
+    }
+
+    for (i = 0; i < map->nregs; i++) {
+        reg = map->order[i];
+        if ((write & REG_BIT(reg)) != 0U) {
+            word_encode(map, reg, cache->shadow[reg], &cache->tx[n * size]);
+            n++;
+        }
+    }
+
+    cache->dirty = 0;
+
+    seq->words = cache->tx;
+    seq->count = n;
+    seq->size  = size;
+    seq->rx    = NULL;
+
+    return n;
+}
+
+/*
+ *@brief  Formats read instructions for every register of an address/data device known to hold its shadow value
+ *@note   Registers not known, dirty registers and the latch register are skipped, regs receives the register
+ *        index of each word. Returns the number of read words written to tx
+ */
+
+uint8_t reg_cache_build_read(const reg_cache_t *cache, uint8_t *tx, uint8_t *regs){
+
+    const reg_cache_map_t *map = cache->map;
+    uint8_t size = spi_profile_get(map->dev->id)->word_size;
+    uint32_t skip = cache->dirty | ~cache->known;
+    uint8_t i, reg, n = 0;
+
+    osalDbgAssert(map->addr != NULL, "control word devices cannot be read back");
+
+    if (map->latch_from != 0U) {
+        skip |= REG_BIT(map->latch_reg);
+    }
+
+    for (i = 0; i < map->nregs; i++) {
+        reg = map->order[i];
+        if ((skip & REG_BIT(reg)) == 0U) {
+            word_encode(map, reg, 0, &tx[n * size]);
+            tx[n * size] |= 0x80U;                          // Read
+            regs[n++] = reg;
+        }
+    }
+
+    return n;
+}
+
+/*
+ *@brief  Writes the dirty registers to the device in one bus session
+ *@note   Returns the number of register words written
+ */
+
+uint8_t reg_cache_flush(reg_cache_t *cache){
+
+    spi_sequence_t seq;
+    uint8_t n = reg_cache_build(cache, &seq);
+
+    if (n > 0U) {
+        spi_device_send(cache->map->dev, &seq, 1);
+        cache->flushes++;
+        cache->words += n;
+    }
+
+    return n;
+}
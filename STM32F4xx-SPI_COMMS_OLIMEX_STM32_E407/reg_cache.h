@@ -0,0 +1,79 @@
+/// @file reg_cache.h
+/// @brief Variable/Function Declarations - Shadow register cache with delta-only reprogramming
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+#include "hal.h"
+#include "spi_device.h"
+
+/// Maximum number of cached registers per device
+#define REG_CACHE_MAX_REGS      16
+
+/// Index value returned when a register word does not belong to the map
+#define REG_CACHE_NO_REG        0xFFU
+
+/*
+ * Register map - register layout and datasheet write order of a device
+ *
+ * 32-bit control word devices (ADF4159/ADF4355) cache the complete word, including the
+ * control bits. Address/data devices (ADA8282/AD9648) cache the data byte of each address.
+ */
+typedef struct {
+    const spi_device_t *dev;            ///< Device the registers belong to
+    uint8_t             nregs;          ///< Number of cached registers
+    const uint8_t      *order;          ///< Register indexes in datasheet write order
+    const uint16_t     *addr;           ///< Register addresses of address/data devices, NULL for control word devices
+    uint8_t           (*decode)(uint32_t word);    ///< Register index of a control word, control word devices only
+    uint32_t            latch_from;     ///< Double buffered registers, only take effect when latch_reg is written
+    uint8_t             latch_reg;      ///< Register that must be written after any register of latch_from
+} reg_cache_map_t;
+
+/*
+ * Shadow register image of one device
+ */
+typedef struct {
+    const reg_cache_map_t *map;                         ///< Register map
+    uint32_t               shadow[REG_CACHE_MAX_REGS];  ///< Register values, indexed by register index
+    uint32_t               known;                       ///< Registers whose shadow holds an intended value, synced or set
+    uint32_t               dirty;                       ///< Known registers differing from the device
+    uint8_t                tx[REG_CACHE_MAX_REGS * 4];  ///< Register words of the last flush, packed
+    uint32_t               flushes;                     ///< Number of flushes that wrote to the device
+    uint32_t               words;                       ///< Number of register words written
+} reg_cache_t;
+
+/*
+ * Register indexes of the ADF4159, the double loaded registers are cached separately
+ */
+#define ADF4159_REG(n)          (n)     ///< R0..R7
+#define ADF4159_REG4_SEL1       8U      ///< R4 with CLK DIV SEL = 1
+#define ADF4159_REG5_SEL1       9U      ///< R5 with DEV SEL = 1
+#define ADF4159_REG6_SEL1       10U     ///< R6 with STEP SEL = 1
+
+/*
+ * Register indexes of the ADF4355
+ */
+#define ADF4355_REG(n)          (n)     ///< R0..R12
+
+/*
+ * Shadow images of the front end devices
+ */
+extern reg_cache_t ADF4159_regs;
+extern reg_cache_t ADF4355_regs;
+extern reg_cache_t ADA8282_U404_regs;
+extern reg_cache_t ADA8282_U405_regs;
+extern reg_cache_t AD9648_regs;
+
+/*
+ * Function declarations
+ */
+void reg_cache_sync(reg_cache_t *cache, const uint8_t *words, uint8_t count);
+void reg_cache_set(reg_cache_t *cache, uint8_t reg, uint32_t value);
+void reg_cache_set_field(reg_cache_t *cache, uint8_t reg, uint32_t mask, uint32_t value);
+uint32_t reg_cache_get(const reg_cache_t *cache, uint8_t reg);
+void reg_cache_invalidate(reg_cache_t *cache);
+uint8_t reg_cache_build(reg_cache_t *cache, spi_sequence_t *seq);
+uint8_t reg_cache_flush(reg_cache_t *cache);
+uint8_t reg_cache_build_read(const reg_cache_t *cache, uint8_t *tx, uint8_t *regs);
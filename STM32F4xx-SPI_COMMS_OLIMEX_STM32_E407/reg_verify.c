@@ -0,0 +1,111 @@
+/// @file reg_verify.c
+/// @brief Full-duplex read-back verification of the front end configuration
+///
+/// Every register of the address/data devices (ADA8282 U404/U405, AD9648) that has
+/// been programmed is read back with full-duplex transfers and compared with its
+/// shadow register value. The read instructions of all devices are exchanged within
+/// a single bus session, each device's reads chained back-to-back by the sequence
+/// engine, so the whole pass takes tens of microseconds.
+///
+/// @author Peter Ludlow
+
+#include <string.h>
+#include "ch.h"
+#include "hal.h"
+#include "chprintf.h"
+#include "reg_verify.h"
+
+// Read instructions and read back words, packed 3 bytes per word
+static uint8_t tx[REG_VERIFY_MAX_DEVICES][REG_CACHE_MAX_REGS * 3];
+static uint8_t rx[REG_VERIFY_MAX_DEVICES][REG_CACHE_MAX_REGS * 3];
+static uint8_t regs[REG_VERIFY_MAX_DEVICES][REG_CACHE_MAX_REGS];
+
+
+/*
+ *@brief  Reads back and checks the programmed registers of a list of address/data devices
+ *@note   Returns true when every register holds its intended value
+ */
+
+bool reg_verify(reg_cache_t *const *caches, uint8_t n, reg_verify_report_t *report){
+
+    spi_sequence_t seq[REG_VERIFY_MAX_DEVICES];
+    const reg_cache_map_t *map;
+    reg_mismatch_t *m;
+    SPIDriver *spip;
+    uint8_t i, j, size, expected, actual;
+
+    osalDbgCheck((caches != NULL) && (n > 0U) && (n <= REG_VERIFY_MAX_DEVICES) && (report != NULL));
+
+    memset(report, 0, sizeof(*report));
+
+    for (i = 0; i < n; i++) {
+        size = spi_profile_get(caches[i]->map->dev->id)->word_size;
+        seq[i].words = tx[i];
+        seq[i].count = reg_cache_build_read(caches[i], tx[i], regs[i]);
+        seq[i].size  = size;
+        seq[i].rx    = rx[i];
+
+        report->dev[i]         = caches[i]->map->dev;
+        report->dev_checked[i] = seq[i].count;
+    }
+    report->devices = n;
+
+    /*
+     * One bus session, the multiplexer and SPI profile are switched between devices
+     */
+
+    spip = spi_device_acquire(caches[0]->map->dev);
+    for (i = 0; i < n; i++) {
+        if (i > 0U) {
+            spi_device_select(caches[i]->map->dev);
+        }
+        spi_sequence_send(spip, &seq[i], 1);
+    }
+    spi_device_release(caches[n - 1U]->map->dev);
+
+    /*
+     * Compare the data byte of every read back word with the shadow register value
+     */
+
+    for (i = 0; i < n; i++) {
+        map = caches[i]->map;
+        for (j = 0; j < seq[i].count; j++) {
+            expected = (uint8_t)reg_cache_get(caches[i], regs[i][j]);
+            actual   = rx[i][(j * seq[i].size) + seq[i].size - 1U];
+
+            report->checked++;
+            if (actual != expected) {
+                if (report->mismatches < REG_VERIFY_MAX_MISMATCHES) {
+                    m = &report->list[report->mismatches];
+                    m->dev      = map->dev;
+                    m->addr     = map->addr[regs[i][j]];
+                    m->expected = expected;
+                    m->actual   = actual;
+                }
+                report->mismatches++;
+            }
+        }
+    }
+
+    return report->mismatches == 0U;
+}
+
+/*
+ *@brief  Prints a verify pass report, the registers read back per device and the first mismatches
+ */
+
+void reg_verify_report_print(BaseSequentialStream *chp, const reg_verify_report_t *report){
+
+    const reg_mismatch_t *m;
+    uint32_t i;
+
+    chprintf(chp, "Register verify %u checked, %u mismatches\r\n", report->checked, report->mismatches);
+    for (i = 0; i < report->devices; i++) {
+        chprintf(chp, "  %-14s %u registers\r\n", spi_profile_get(report->dev[i]->id)->name, report->dev_checked[i]);
+    }
+    for (i = 0; (i < report->mismatches) && (i < REG_VERIFY_MAX_MISMATCHES); i++) {
+        m = &report->list[i];
+        chprintf(chp, "  %-14s 0x%04x expected 0x%02x read 0x%02x\r\n", spi_profile_get(m->dev->id)->name,
+                 m->addr, m->expected, m->actual);
+    }
+}
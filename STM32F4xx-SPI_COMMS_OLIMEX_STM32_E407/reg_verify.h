@@ -0,0 +1,44 @@
+/// @file reg_verify.h
+/// @brief Variable/Function Declarations - Full-duplex read-back verification of the front end configuration
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+#include "hal.h"
+#include "reg_cache.h"
+
+/// Maximum number of mismatches recorded in a report
+#define REG_VERIFY_MAX_MISMATCHES   8
+
+/// Maximum number of devices verified in one pass
+#define REG_VERIFY_MAX_DEVICES      4
+
+/*
+ * Register read back differing from its intended value
+ */
+typedef struct {
+    const spi_device_t *dev;        ///< Device
+    uint16_t            addr;       ///< Register address
+    uint8_t             expected;   ///< Programmed value
+    uint8_t             actual;     ///< Value read back
+} reg_mismatch_t;
+
+/*
+ * Verify pass report
+ */
+typedef struct {
+    uint32_t            checked;                                ///< Registers read back
+    uint32_t            mismatches;                             ///< Registers differing from their intended value
+    reg_mismatch_t      list[REG_VERIFY_MAX_MISMATCHES];        ///< First mismatches
+    uint8_t             devices;                                ///< Devices in the pass
+    const spi_device_t *dev[REG_VERIFY_MAX_DEVICES];            ///< Device of each cache
+    uint8_t             dev_checked[REG_VERIFY_MAX_DEVICES];    ///< Registers read back per device, 0 when none is known to be programmed
+} reg_verify_report_t;
+
+/*
+ * Function declarations
+ */
+bool reg_verify(reg_cache_t *const *caches, uint8_t n, reg_verify_report_t *report);
+void reg_verify_report_print(BaseSequentialStream *chp, const reg_verify_report_t *report);
@@ -0,0 +1,95 @@
+/// @file spi_bus.c
+/// @brief Persistent SPI1 bus sessions for the RF front end
+///
+/// SPI1 is started once and left running between sessions. A session only
+/// takes the bus lock, and the peripheral is reprogrammed only when a session
+/// asks for a different configuration from the one currently loaded.
+///
+/// @author Peter Ludlow
+
+#include "ch.h"
+#include "hal.h"
+#include "spi_bus.h"
+
+
+static spi_bus_stats_t stats;
+
+
+/*
+ *@brief  Checks whether two configurations program the peripheral identically
+ */
+
+static bool same_config(const SPIConfig *a, const SPIConfig *b){
+
+    return (a->end_cb == b->end_cb) && (a->ssport == b->ssport) &&
+           (a->sspad == b->sspad) && (a->cr1 == b->cr1);
+}
+
+/*
+ *@brief  Opens a bus session, starting or reconfiguring SPI1 only when required
+ *@note   Returns the driver to be used until spi_bus_release() is called
+ */
+
+SPIDriver *spi_bus_acquire(const SPIConfig *config){
+
+    SPIDriver *spip = SPI_BUS_DRIVER;
+
+    spiAcquireBus(spip);
+    stats.sessions++;
+
+    spi_bus_reconfigure(config);
+
+    return spip;
+}
+
+/*
+ *@brief  Loads another configuration within an open bus session, only if it differs from the loaded one
+ */
+
+void spi_bus_reconfigure(const SPIConfig *config){
+
+    SPIDriver *spip = SPI_BUS_DRIVER;
+
+    if (spip->state == SPI_STOP) {
+        spiStart(spip, config);
+        stats.starts++;
+    }
+    else if ((spip->config != config) && !same_config(spip->config, config)) {
+        spiStart(spip, config);
+        stats.reconfigs++;
+    }
+}
+
+/*
+ *@brief  Closes a bus session, SPI1 is left running for the next session
+ */
+
+void spi_bus_release(void){
+
+    spiReleaseBus(SPI_BUS_DRIVER);
+}
+
+/*
+ *@brief  Powers SPI1 and its DMA streams down, e.g. before entering a low power state
+ */
+
+void spi_bus_power_down(void){
+
+    SPIDriver *spip = SPI_BUS_DRIVER;
+
+    spiAcquireBus(spip);
+    if (spip->state != SPI_STOP) {
+        spiStop(spip);
+        stats.stops++;
+    }
+    spiReleaseBus(spip);
+}
+
+/*
+ *@brief  Returns the bus statistics
+ */
+
+const spi_bus_stats_t *spi_bus_get_stats(void){
+
+    return &stats;
+}
@@ -0,0 +1,31 @@
+/// @file spi_bus.h
+/// @brief Variable/Function Declarations - Persistent SPI1 bus sessions for the RF front end
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+#include "hal.h"
+
+/// SPI driver shared by the ADF4159, ADF4355, ADA8282 and AD9648
+#define SPI_BUS_DRIVER      (&SPID1)
+
+/*
+ * Bus statistics, used to verify that the peripheral is no longer power cycled per block
+ */
+typedef struct {
+    uint32_t sessions;      ///< Number of spi_bus_acquire() calls
+    uint32_t starts;        ///< Peripheral (and DMA stream) power ups
+    uint32_t reconfigs;     ///< Configuration changes of an already running peripheral
+    uint32_t stops;         ///< Peripheral power downs
+} spi_bus_stats_t;
+
+/*
+ * Function declarations
+ */
+SPIDriver *spi_bus_acquire(const SPIConfig *config);
+void spi_bus_reconfigure(const SPIConfig *config);
+void spi_bus_release(void);
+void spi_bus_power_down(void);
+const spi_bus_stats_t *spi_bus_get_stats(void);
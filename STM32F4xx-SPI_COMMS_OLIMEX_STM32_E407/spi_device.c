@@ -0,0 +1,156 @@
+/// @file spi_device.c
+/// @brief Front end SPI device handles and chip select multiplexer
+///
+/// Every front end device is reached through SPI1 NSS routed by the GPIOG_SPI_NSS_S0/S1
+/// multiplexer. A device handle owns its multiplexer code. Acquiring a handle takes the
+/// bus lock, loads the device SPI profile and, only when the multiplexer is routed to
+/// another device, drives S0/S1 and waits for the multiplexer to settle. Multiplexer
+/// changes are therefore serialized with the bus lock.
+///
+/// @author Peter Ludlow
+
+#include "ch.h"
+#include "hal.h"
+#include "spi_bus.h"
+#include "spi_device.h"
+
+
+/// Multiplexer state before the first acquisition, forces S0/S1 to be written
+#define SPI_MUX_UNKNOWN     0xFEU
+
+/// Multiplexer settle time in CPU cycles
+#define SPI_MUX_SETTLE_CYCLES   ((rtcnt_t)(((uint64_t)STM32_HCLK * SPI_MUX_SETTLE_NS + 999999999U) / 1000000000U))
+
+
+/*
+ * Device handles, indexed by spi_device_id_t
+ *
+ * The AD9648 chip select is not routed through the multiplexer, it is left as is
+ */
+
+const spi_device_t spi_devices[SPI_DEVICE_COUNT] = {
+        {SPI_DEVICE_ADF4159,      SPI_MUX_CODE(0, 0)},
+        {SPI_DEVICE_ADF4355,      SPI_MUX_CODE(1, 0)},
+        {SPI_DEVICE_ADA8282_U404, SPI_MUX_CODE(0, 1)},
+        {SPI_DEVICE_ADA8282_U405, SPI_MUX_CODE(1, 1)},
+        {SPI_DEVICE_AD9648,       SPI_MUX_NONE},
+};
+
+static uint8_t mux_state = SPI_MUX_UNKNOWN;     // Code currently driven on S0/S1, bus lock protected
+static spi_mux_stats_t mux_stats;
+
+// Bus time spent per device, between spi_device_acquire() and spi_device_release()
+static time_measurement_t bus_time[SPI_DEVICE_COUNT];
+static bool bus_time_init;
+static const spi_device_t *current;             // Device of the open bus session
+
+
+/*
+ *@brief  Routes the chip select multiplexer, the bus lock must be held
+ */
+
+static void mux_route(uint8_t mux){
+
+    if ((mux == SPI_MUX_NONE) || (mux == mux_state)) {
+        mux_stats.skipped++;
+        return;
+    }
+
+    palWritePad(GPIOG, GPIOG_SPI_NSS_S0, mux & 1U);
+    palWritePad(GPIOG, GPIOG_SPI_NSS_S1, (mux >> 1) & 1U);
+    mux_state = mux;
+    mux_stats.switches++;
+
+    chSysPolledDelayX(SPI_MUX_SETTLE_CYCLES);
+}
+
+/*
+ *@brief  Opens a bus session for a device - loads its SPI profile and routes the multiplexer to it
+ */
+
+SPIDriver *spi_device_acquire(const spi_device_t *dev){
+
+    SPIDriver *spip;
+    int i;
+
+    osalDbgCheck(dev != NULL);
+
+    spip = spi_bus_acquire(spi_profile_get(dev->id)->config);
+
+    if (!bus_time_init) {
+        for (i = 0; i < SPI_DEVICE_COUNT; i++) {
+            chTMObjectInit(&bus_time[i]);
+        }
+        bus_time_init = true;
+    }
+
+    mux_route(dev->mux);
+
+    current = dev;
+    chTMStartMeasurementX(&bus_time[dev->id]);
+
+    return spip;
+}
+
+/*
+ *@brief  Switches an open bus session to another device, without releasing the bus
+ */
+
+void spi_device_select(const spi_device_t *dev){
+
+    osalDbgCheck(dev != NULL);
+    osalDbgAssert(current != NULL, "no open session");
+
+    chTMStopMeasurementX(&bus_time[current->id]);
+
+    spi_bus_reconfigure(spi_profile_get(dev->id)->config);
+    mux_route(dev->mux);
+
+    current = dev;
+    chTMStartMeasurementX(&bus_time[dev->id]);
+}
+
+/*
+ *@brief  Closes the bus session of a device
+ */
+
+void spi_device_release(const spi_device_t *dev){
+
+    osalDbgAssert(dev == current, "device not selected");
+
+    chTMStopMeasurementX(&bus_time[dev->id]);
+    current = NULL;
+
+    spi_bus_release();
+}
+
+/*
+ *@brief  Sends a register sequence list to a device within one bus session
+ */
+
+void spi_device_send(const spi_device_t *dev, const spi_sequence_t *list, uint8_t n){
+
+    SPIDriver *spip = spi_device_acquire(dev);
+
+    spi_sequence_send(spip, list, n);
+
+    spi_device_release(dev);
+}
+
+/*
+ *@brief  Returns the bus time statistics of a device, in realtime counter (CPU) cycles
+ */
+
+const time_measurement_t *spi_device_get_bus_time(const spi_device_t *dev){
+
+    return &bus_time[dev->id];
+}
+
+/*
+ *@brief  Returns the multiplexer statistics
+ */
+
+const spi_mux_stats_t *spi_device_get_mux_stats(void){
+
+    return &mux_stats;
+}
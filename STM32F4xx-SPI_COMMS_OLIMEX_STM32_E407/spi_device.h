@@ -0,0 +1,59 @@
+/// @file spi_device.h
+/// @brief Variable/Function Declarations - Front end SPI device handles and chip select multiplexer
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+#include "hal.h"
+#include "spi_profile.h"
+#include "spi_sequence.h"
+
+/// Multiplexer code, bit 0 drives GPIOG_SPI_NSS_S0 and bit 1 drives GPIOG_SPI_NSS_S1
+#define SPI_MUX_CODE(s1, s0)    ((uint8_t)(((s1) << 1) | (s0)))
+
+/// Multiplexer code of a device that is not routed through GPIOG_SPI_NSS_S0/S1
+#define SPI_MUX_NONE            0xFFU
+
+/// Multiplexer settle time after S0/S1 change, before the chip select may be asserted (nS)
+#if !defined(SPI_MUX_SETTLE_NS)
+#define SPI_MUX_SETTLE_NS       100U
+#endif
+
+/*
+ * Device handle
+ */
+typedef struct {
+    spi_device_id_t id;     ///< Device index, selects the SPI profile
+    uint8_t         mux;    ///< Chip select multiplexer code routing SPI1 NSS to the device
+} spi_device_t;
+
+/*
+ * Multiplexer statistics
+ */
+typedef struct {
+    uint32_t switches;      ///< S0/S1 changes, each followed by the settle time
+    uint32_t skipped;       ///< Acquisitions for which the multiplexer was already routed
+} spi_mux_stats_t;
+
+/*
+ * Device handles
+ */
+extern const spi_device_t spi_devices[SPI_DEVICE_COUNT];
+
+#define SPI_ADF4159         (&spi_devices[SPI_DEVICE_ADF4159])
+#define SPI_ADF4355         (&spi_devices[SPI_DEVICE_ADF4355])
+#define SPI_ADA8282_U404    (&spi_devices[SPI_DEVICE_ADA8282_U404])
+#define SPI_ADA8282_U405    (&spi_devices[SPI_DEVICE_ADA8282_U405])
+#define SPI_AD9648          (&spi_devices[SPI_DEVICE_AD9648])
+
+/*
+ * Function declarations
+ */
+SPIDriver *spi_device_acquire(const spi_device_t *dev);
+void spi_device_select(const spi_device_t *dev);
+void spi_device_release(const spi_device_t *dev);
+void spi_device_send(const spi_device_t *dev, const spi_sequence_t *list, uint8_t n);
+const time_measurement_t *spi_device_get_bus_time(const spi_device_t *dev);
+const spi_mux_stats_t *spi_device_get_mux_stats(void);
@@ -0,0 +1,108 @@
+/// @file spi_profile.c
+/// @brief Per-device SPI clock/mode profiles for the RF front end
+///
+/// Each device on SPI1 gets its own CR1 value, derived from the maximum SCLK in its
+/// datasheet. spi_bus_acquire() only touches the peripheral when the configuration
+/// of the device being acquired differs from the loaded one.
+///
+/// @author Peter Ludlow
+
+#include "ch.h"
+#include "hal.h"
+#include "spi_profile.h"
+#include "spi_sequence.h"
+
+
+/*===============================================================*/
+/*Baud Rate Selection                                            */
+/*===============================================================*/
+
+// SPI1 is clocked from APB2, fPCLK2 = 168 MHz / 2 = 84 MHz
+
+/*
+ * Baud rate control bits giving the fastest SCLK = fPCLK2 / 2^(BR+1) not above hz
+ */
+#define SPI_BR_BITS(hz)                                                        \
+    (((STM32_PCLK2 / 2U)   <= (hz)) ? 0U :                                     \
+     ((STM32_PCLK2 / 4U)   <= (hz)) ? (SPI_CR1_BR_0) :                         \
+     ((STM32_PCLK2 / 8U)   <= (hz)) ? (SPI_CR1_BR_1) :                         \
+     ((STM32_PCLK2 / 16U)  <= (hz)) ? (SPI_CR1_BR_1 | SPI_CR1_BR_0) :          \
+     ((STM32_PCLK2 / 32U)  <= (hz)) ? (SPI_CR1_BR_2) :                         \
+     ((STM32_PCLK2 / 64U)  <= (hz)) ? (SPI_CR1_BR_2 | SPI_CR1_BR_0) :          \
+     ((STM32_PCLK2 / 128U) <= (hz)) ? (SPI_CR1_BR_2 | SPI_CR1_BR_1) :          \
+                                      (SPI_CR1_BR_2 | SPI_CR1_BR_1 | SPI_CR1_BR_0))
+
+/*
+ * SCLK frequency generated by SPI_BR_BITS(hz)
+ */
+#define SPI_SCLK(hz)                                                           \
+    (STM32_PCLK2 / (2U << (SPI_BR_BITS(hz) / SPI_CR1_BR_0)))
+
+/*
+ * Datasheet maximum SCLK of each device
+ */
+#define ADF4159_MAX_SCLK    50000000U   // t4/t5 CLK high/low duration = 10 nS
+#define ADF4355_MAX_SCLK    50000000U   // t4/t5 CLK high/low duration = 10 nS
+#define ADA8282_MAX_SCLK    25000000U   // tCLK = 40 nS
+#define AD9648_MAX_SCLK     25000000U   // tCLK = 40 nS
+
+
+/*===============================================================*/
+/*Configuration Structures                                       */
+/*===============================================================*/
+
+/*
+ * All parts sample SDATA/SDIO on the rising SCLK edge, CPOL=1/CPHA=1 [CLK to 1 when idle,
+ * 2ND CLK transition is the 1st data capture edge] is kept as proven on the board, MSB first
+ */
+
+static const SPIConfig ADF4159_spicfg = {
+        spi_sequence_end_cb,
+        GPIOA,
+        GPIOA_SPI1_NSS,
+        SPI_BR_BITS(ADF4159_MAX_SCLK) | SPI_CR1_CPOL | SPI_CR1_CPHA
+};
+
+static const SPIConfig ADF4355_spicfg = {
+        spi_sequence_end_cb,
+        GPIOA,
+        GPIOA_SPI1_NSS,
+        SPI_BR_BITS(ADF4355_MAX_SCLK) | SPI_CR1_CPOL | SPI_CR1_CPHA
+};
+
+static const SPIConfig ADA8282_spicfg = {
+        spi_sequence_end_cb,
+        GPIOA,
+        GPIOA_SPI1_NSS,
+        SPI_BR_BITS(ADA8282_MAX_SCLK) | SPI_CR1_CPOL | SPI_CR1_CPHA
+};
+
+static const SPIConfig AD9648_spicfg = {
+        spi_sequence_end_cb,
+        GPIOA,
+        GPIOA_SPI1_NSS,
+        SPI_BR_BITS(AD9648_MAX_SCLK) | SPI_CR1_CPOL | SPI_CR1_CPHA
+};
+
+/*
+ * Device profile table, indexed by spi_device_id_t
+ */
+
+static const spi_profile_t profiles[SPI_DEVICE_COUNT] = {
+        {"ADF4159",      ADF4159_MAX_SCLK, SPI_SCLK(ADF4159_MAX_SCLK), &ADF4159_spicfg, 4},
+        {"ADF4355",      ADF4355_MAX_SCLK, SPI_SCLK(ADF4355_MAX_SCLK), &ADF4355_spicfg, 4},
+        {"ADA8282 U404", ADA8282_MAX_SCLK, SPI_SCLK(ADA8282_MAX_SCLK), &ADA8282_spicfg, 3},
+        {"ADA8282 U405", ADA8282_MAX_SCLK, SPI_SCLK(ADA8282_MAX_SCLK), &ADA8282_spicfg, 3},
+        {"AD9648",       AD9648_MAX_SCLK,  SPI_SCLK(AD9648_MAX_SCLK),  &AD9648_spicfg,  3},
+};
+
+/*
+ *@brief  Returns the profile of a device
+ */
+
+const spi_profile_t *spi_profile_get(spi_device_id_t dev){
+
+    osalDbgCheck(dev < SPI_DEVICE_COUNT);
+
+    return &profiles[dev];
+}
@@ -0,0 +1,37 @@
+/// @file spi_profile.h
+/// @brief Variable/Function Declarations - Per-device SPI clock/mode profiles for the RF front end
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+#include "hal.h"
+
+/*
+ * Devices sharing SPI1 behind the GPIOG_SPI_NSS_S0/S1 chip select multiplexer
+ */
+typedef enum {
+    SPI_DEVICE_ADF4159 = 0,
+    SPI_DEVICE_ADF4355,
+    SPI_DEVICE_ADA8282_U404,
+    SPI_DEVICE_ADA8282_U405,
+    SPI_DEVICE_AD9648,
+    SPI_DEVICE_COUNT
+} spi_device_id_t;
+
+/*
+ * Device profile
+ */
+typedef struct {
+    const char      *name;          ///< Device name, for diagnostics
+    uint32_t         max_sclk;      ///< Maximum SCLK accepted by the device (Hz)
+    uint32_t         sclk;          ///< SCLK actually generated by the profile (Hz)
+    const SPIConfig *config;        ///< SPI1 configuration (CR1 baud rate, CPOL/CPHA)
+    uint8_t          word_size;     ///< Bytes per register word
+} spi_profile_t;
+
+/*
+ * Function declarations
+ */
+const spi_profile_t *spi_profile_get(spi_device_id_t dev);
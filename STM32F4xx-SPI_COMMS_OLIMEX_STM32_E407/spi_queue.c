@@ -0,0 +1,128 @@
+/// @file spi_queue.c
+/// @brief Asynchronous priority ordered SPI request queue
+///
+/// Callers post register batches and continue running. A dedicated driver thread
+/// takes the highest priority request, opens a bus session for its device, plays
+/// the batch out through the sequence engine and reports completion through the
+/// request callback and/or an event mask signalled to the posting thread.
+///
+/// @author Peter Ludlow
+
+#include "ch.h"
+#include "hal.h"
+#include "spi_queue.h"
+
+
+/*===============================================================*/
+/*Queue State                                                    */
+/*===============================================================*/
+
+static spi_request_t *head;             // Pending requests, highest priority first
+static semaphore_t pending;             // Counts the pending requests
+static spi_queue_stats_t stats;
+
+static THD_WORKING_AREA(spi_queue_wa, 512);
+
+
+/*
+ *@brief  SPI queue driver thread
+ */
+
+static THD_FUNCTION(spi_queue_thread, arg){
+
+    spi_request_t *req;
+    spi_request_cb_t cb;
+    thread_t *tp;
+    eventmask_t events;
+    rtcnt_t wait;
+
+    (void)arg;
+    chRegSetThreadName("spi_queue");
+
+    while (true) {
+        (void) chSemWait(&pending);
+
+        chSysLock();
+        req = head;
+        head = req->next;
+        stats.depth--;
+        chSysUnlock();
+
+        wait = chSysGetRealtimeCounterX() - req->posted;
+        stats.last_wait = wait;
+        stats.total_wait += wait;
+        if (wait > stats.max_wait) {
+            stats.max_wait = wait;
+        }
+
+        spi_device_send(req->dev, req->list, req->n);
+
+        // The request may be reused by its owner as soon as done is set
+        cb = req->cb;
+        tp = req->thread;
+        events = req->events;
+        stats.completed++;
+        req->done = true;
+
+        if (cb != NULL) {
+            cb(req);
+        }
+        if (tp != NULL) {
+            chEvtSignal(tp, events);
+        }
+    }
+}
+
+/*
+ *@brief  Starts the SPI queue driver thread, must be called once after chSysInit()
+ */
+
+void spi_queue_init(void){
+
+    head = NULL;
+    chSemObjectInit(&pending, 0);
+
+    (void) chThdCreateStatic(spi_queue_wa, sizeof(spi_queue_wa), SPI_QUEUE_THREAD_PRIO, spi_queue_thread, NULL);
+}
+
+/*
+ *@brief  Posts a request, returns immediately
+ *@note   Requests of equal priority are serviced in posting order
+ */
+
+void spi_queue_post(spi_request_t *req){
+
+    spi_request_t **pp;
+
+    osalDbgCheck((req != NULL) && (req->list != NULL) && (req->dev != NULL));
+
+    req->done = false;
+
+    chSysLock();
+    req->posted = chSysGetRealtimeCounterX();
+
+    pp = &head;
+    while ((*pp != NULL) && ((*pp)->prio >= req->prio)) {
+        pp = &(*pp)->next;
+    }
+    req->next = *pp;
+    *pp = req;
+
+    stats.posted++;
+    if (++stats.depth > stats.max_depth) {
+        stats.max_depth = stats.depth;
+    }
+
+    chSemSignalI(&pending);
+    chSchRescheduleS();
+    chSysUnlock();
+}
+
+/*
+ *@brief  Returns the queue statistics
+ */
+
+const spi_queue_stats_t *spi_queue_get_stats(void){
+
+    return &stats;
+}
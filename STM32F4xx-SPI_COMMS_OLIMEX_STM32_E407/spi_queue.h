@@ -0,0 +1,57 @@
+/// @file spi_queue.h
+/// @brief Variable/Function Declarations - Asynchronous priority ordered SPI request queue
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+#include "hal.h"
+#include "spi_device.h"
+
+/// Priority of the SPI queue driver thread
+#if !defined(SPI_QUEUE_THREAD_PRIO)
+#define SPI_QUEUE_THREAD_PRIO   (NORMALPRIO + 2)
+#endif
+
+typedef struct spi_request spi_request_t;
+
+/// Completion callback, invoked from the SPI queue driver thread
+typedef void (*spi_request_cb_t)(spi_request_t *req);
+
+/*
+ * SPI request - a register batch for one device, owned by the caller until completion
+ */
+struct spi_request {
+    spi_request_t        *next;     ///< Queue link, managed by the queue
+    const spi_device_t   *dev;      ///< Target device
+    const spi_sequence_t *list;     ///< Register sequence list to send
+    uint8_t               n;        ///< Number of descriptors in the list
+    uint8_t               prio;     ///< Request priority, higher values are serviced first
+    volatile bool         done;     ///< Set once the batch has been sent
+    spi_request_cb_t      cb;       ///< Completion callback, may be NULL
+    thread_t             *thread;   ///< Thread to signal on completion, may be NULL
+    eventmask_t           events;   ///< Events signalled to thread on completion
+    void                 *arg;      ///< Caller data for the callback
+    rtcnt_t               posted;   ///< Realtime counter value when the request was posted
+};
+
+/*
+ * Queue statistics
+ */
+typedef struct {
+    uint32_t posted;        ///< Number of requests posted
+    uint32_t completed;     ///< Number of requests completed
+    uint32_t depth;         ///< Requests currently waiting
+    uint32_t max_depth;     ///< Maximum number of requests waiting at the same time
+    rtcnt_t  last_wait;     ///< Post to start of service of the last request (CPU cycles)
+    rtcnt_t  max_wait;      ///< Worst post to start of service time (CPU cycles)
+    rttime_t total_wait;    ///< Accumulated post to start of service time (CPU cycles)
+} spi_queue_stats_t;
+
+/*
+ * Function declarations
+ */
+void spi_queue_init(void);
+void spi_queue_post(spi_request_t *req);
+const spi_queue_stats_t *spi_queue_get_stats(void);
@@ -0,0 +1,141 @@
+/// @file spi_sequence.c
+/// @brief Descriptor driven SPI register sequence engine
+///
+/// A whole list of register tables is clocked out in one call: the first word is
+/// started from thread context, every following word is chained from the SPI DMA
+/// completion callback (chip select raised, re-asserted, next DMA transfer started)
+/// and the calling thread is only woken once, when the last word has been sent.
+///
+/// The STM32F4 SPI peripheral has no NSS pulse mode, so the chip select toggling
+/// between words is done in the completion callback rather than by the hardware.
+/// This removes the per-word DMA setup from thread context, the per-word thread
+/// wakeup and the per-word mutex/driver handling of the spiSend() loop.
+///
+/// @author Peter Ludlow
+
+#include "ch.h"
+#include "hal.h"
+#include "spi_sequence.h"
+
+
+/*===============================================================*/
+/*Engine State                                                   */
+/*===============================================================*/
+
+static struct {
+    const spi_sequence_t *desc;     // Descriptor being played out, NULL when idle
+    const spi_sequence_t *end;      // One past the last descriptor of the list
+    const uint8_t        *next;     // Next register word of the current descriptor
+    uint8_t              *rx;       // Receive position of the next word, NULL when discarded
+    uint8_t               left;     // Words left in the current descriptor
+    thread_reference_t    thread;   // Thread waiting for the list to complete
+} engine;
+
+static spi_sequence_stats_t stats;
+
+
+/*
+ *@brief  Starts the transfer of the next register word of the list
+ *@note   Returns false once every descriptor has been consumed
+ */
+
+static bool start_next_word(SPIDriver *spip){
+
+    const uint8_t *word;
+    uint8_t *rx;
+    uint8_t size;
+
+    while (engine.left == 0U) {
+        if (++engine.desc >= engine.end) {
+            return false;
+        }
+        engine.next = engine.desc->words;
+        engine.rx   = engine.desc->rx;
+        engine.left = engine.desc->count;
+    }
+
+    size = engine.desc->size;
+    word = engine.next;
+    rx   = engine.rx;
+    engine.next += size;
+    if (rx != NULL) {
+        engine.rx += size;
+    }
+    engine.left--;
+
+    spiSelectI(spip);
+    if (rx != NULL) {
+        spiStartExchangeI(spip, size, word, rx);
+    }
+    else {
+        spiStartSendI(spip, size, word);
+    }
+
+    return true;
+}
+
+/*
+ *@brief  SPI end of transfer callback, must be the end_cb of any SPIConfig used with the engine
+ *@note   Called from the SPI DMA ISR, transfers not started by the engine are ignored
+ */
+
+void spi_sequence_end_cb(SPIDriver *spip){
+
+    if (engine.desc == NULL) {
+        return;
+    }
+
+    spiUnselectI(spip);
+    stats.words++;
+
+    if (start_next_word(spip)) {
+        return;
+    }
+
+    // Whole list sent, wake the caller
+    engine.desc = NULL;
+    osalSysLockFromISR();
+    osalThreadResumeI(&engine.thread, MSG_OK);
+    osalSysUnlockFromISR();
+}
+
+/*
+ *@brief  Sends a list of register tables as one back-to-back transaction
+ *@note   The caller must own the bus and the driver must be started with a
+ *        configuration having spi_sequence_end_cb() as its end_cb
+ */
+
+void spi_sequence_send(SPIDriver *spip, const spi_sequence_t *list, uint8_t n){
+
+    osalDbgCheck((spip != NULL) && (list != NULL));
+    osalDbgAssert(spip->config->end_cb == spi_sequence_end_cb, "engine callback not installed");
+
+    osalSysLock();
+    osalDbgAssert(engine.desc == NULL, "engine busy");
+
+    engine.desc = list;
+    engine.end  = list + n;
+    engine.next = list->words;
+    engine.rx   = list->rx;
+    engine.left = (n > 0U) ? list->count : 0U;
+
+    if ((n == 0U) || !start_next_word(spip)) {
+        // Nothing to send
+        engine.desc = NULL;
+        osalSysUnlock();
+        return;
+    }
+
+    (void) osalThreadSuspendS(&engine.thread);
+    stats.sequences++;
+    osalSysUnlock();
+}
+
+/*
+ *@brief  Returns the engine statistics
+ */
+
+const spi_sequence_stats_t *spi_sequence_get_stats(void){
+
+    return &stats;
+}
@@ -0,0 +1,49 @@
+/// @file spi_sequence.h
+/// @brief Variable/Function Declarations - Descriptor driven SPI register sequence engine
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+#include "hal.h"
+
+/*
+ * Register sequence descriptor
+ *
+ * Describes a contiguous table of equally sized register words, e.g. one of the
+ * uint8_t buf[n][4] power-on tables, which is played out word by word with the
+ * chip select line toggled between words (the synthesizers latch on LE rising).
+ * When rx is set the words are exchanged full duplex and the bytes clocked in on
+ * MISO are stored at rx, packed with the same word size.
+ */
+typedef struct {
+    const uint8_t *words;   ///< First byte of the first register word
+    uint8_t        count;   ///< Number of register words in the table
+    uint8_t        size;    ///< Number of bytes per register word
+    uint8_t       *rx;      ///< Receive buffer of count * size bytes, NULL to discard MISO
+} spi_sequence_t;
+
+/// Builds a descriptor covering every row of a two dimensional register table
+#define SPI_SEQUENCE(table)                                                   \
+    { &(table)[0][0], (uint8_t)(sizeof(table) / sizeof((table)[0])),          \
+      (uint8_t)sizeof((table)[0]), NULL }
+
+/// Builds a descriptor covering the first n rows of a register table
+#define SPI_SEQUENCE_N(table, n)                                              \
+    { &(table)[0][0], (uint8_t)(n), (uint8_t)sizeof((table)[0]), NULL }
+
+/*
+ * Engine statistics
+ */
+typedef struct {
+    uint32_t sequences;     ///< Number of completed spi_sequence_send() calls
+    uint32_t words;         ///< Number of register words clocked out
+} spi_sequence_stats_t;
+
+/*
+ * Function declarations
+ */
+void spi_sequence_end_cb(SPIDriver *spip);
+void spi_sequence_send(SPIDriver *spip, const spi_sequence_t *list, uint8_t n);
+const spi_sequence_stats_t *spi_sequence_get_stats(void);
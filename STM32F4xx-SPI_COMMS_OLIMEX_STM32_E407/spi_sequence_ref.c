@@ -0,0 +1,309 @@
+/// @file spi_sequence_ref.c
+/// @brief Host reference build of the SPI register sequence engine, not part of the firmware
+///
+/// Runs the same spi_sequence.c on a PC against a mock SPI back end, which records every
+/// chip select edge and register word with a modelled time stamp, checks that the words
+/// clocked out are the tables handed to the engine, in order, one chip select frame per
+/// word, and prints the per-word timing:
+///
+///   gcc -O2 -Ihost -I. -o spi_sequence_ref spi_sequence_ref.c spi_sequence.c
+///   spi_sequence_ref [-x] clock_hz [isr_ns [cs_ns]] < tables.txt
+///
+/// host/ch.h and host/hal.h stand in for the ChibiOS headers. The tables are read as one
+/// register word per line in hex bytes, MSB first as in the init_functions.c tables, e.g.
+/// 30010984, with a blank line between tables; all the words of a table have one size.
+/// -x exchanges instead of sending, the mock ties MISO to MOSI and the received words
+/// are checked against the sent ones.
+///
+/// The model: a word takes size * 8 SPI clocks, the completion callback runs isr_ns
+/// after the last clock and chip select stays high for cs_ns before the next word is
+/// started from the callback. Exit status 0 when every check passes.
+///
+/// @author Peter Ludlow
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "spi_sequence.h"
+
+#define SEQ_REF_MAX_WORDS       1024U
+#define SEQ_REF_MAX_TABLES      32U
+#define SEQ_REF_MAX_SIZE        8U
+
+/// Default DMA completion to callback latency
+#define SEQ_REF_ISR_NS          500U
+
+/// Default chip select high time between words
+#define SEQ_REF_CS_NS           200U
+
+/*
+ * One recorded chip select frame
+ */
+typedef struct {
+    uint8_t  bytes[SEQ_REF_MAX_SIZE];
+    uint32_t size;          // Bytes clocked in the frame
+    uint64_t select;        // Chip select low
+    uint64_t sent;          // Last clock of the word
+    uint64_t unselect;      // Chip select high
+} seq_ref_word_t;
+
+static uint8_t tx[SEQ_REF_MAX_WORDS * SEQ_REF_MAX_SIZE];
+static uint8_t rx[SEQ_REF_MAX_WORDS * SEQ_REF_MAX_SIZE];
+static spi_sequence_t tables[SEQ_REF_MAX_TABLES];
+static seq_ref_word_t record[SEQ_REF_MAX_WORDS];
+
+
+/*===============================================================*/
+/*Mock SPI Back End                                              */
+/*===============================================================*/
+
+static struct {
+    uint64_t now;           // Model time, ns
+    uint32_t clock_hz;      // SPI clock
+    uint32_t isr_ns;        // DMA completion to callback
+    uint32_t cs_ns;         // Chip select high time between words
+    uint32_t frames;        // Recorded frames
+    bool     selected;      // Chip select asserted
+    bool     pending;       // Transfer in flight, callback due
+    bool     waiting;       // Caller suspended
+    bool     error;         // Protocol violation seen
+    SPIDriver *drv;         // Driver of the transfer in flight
+} mock;
+
+static void mock_transfer(SPIDriver *spip, size_t n, const void *txbuf, void *rxbuf){
+
+    seq_ref_word_t *w = &record[mock.frames];
+
+    if (!mock.selected || mock.pending || (n == 0U) || (n > SEQ_REF_MAX_SIZE) || (w->size != 0U)) {
+        mock.error = true;
+        return;
+    }
+
+    memcpy(w->bytes, txbuf, n);
+    if (rxbuf != NULL) {
+        memcpy(rxbuf, txbuf, n);
+    }
+    w->size = (uint32_t)n;
+    mock.now += (((uint64_t)n * 8U * 1000000000U) + mock.clock_hz - 1U) / mock.clock_hz;
+    w->sent = mock.now;
+    mock.drv = spip;
+    mock.pending = true;
+}
+
+void spiSelectI(SPIDriver *spip){
+
+    (void) spip;
+    if (mock.selected || (mock.frames >= SEQ_REF_MAX_WORDS)) {
+        mock.error = true;
+        return;
+    }
+
+    mock.selected = true;
+    record[mock.frames].select = mock.now;
+}
+
+void spiUnselectI(SPIDriver *spip){
+
+    (void) spip;
+    if (!mock.selected || mock.pending) {
+        mock.error = true;
+        return;
+    }
+
+    mock.selected = false;
+    record[mock.frames].unselect = mock.now;
+    mock.frames++;
+    mock.now += mock.cs_ns;
+}
+
+void spiStartSendI(SPIDriver *spip, size_t n, const void *txbuf){
+
+    mock_transfer(spip, n, txbuf, NULL);
+}
+
+void spiStartExchangeI(SPIDriver *spip, size_t n, const void *txbuf, void *rxbuf){
+
+    mock_transfer(spip, n, txbuf, rxbuf);
+}
+
+/*
+ *@brief  The caller sleeps here, the DMA completion interrupts are run until it is woken
+ */
+
+msg_t osalThreadSuspendS(thread_reference_t *trp){
+
+    (void) trp;
+    mock.waiting = true;
+    while (mock.waiting && mock.pending) {
+        mock.pending = false;
+        mock.now += mock.isr_ns;
+        mock.drv->config->end_cb(mock.drv);
+    }
+
+    if (mock.waiting) {
+        // Never woken, the engine lost the list
+        mock.error = true;
+    }
+
+    return MSG_OK;
+}
+
+void osalThreadResumeI(thread_reference_t *trp, msg_t msg){
+
+    (void) trp;
+    (void) msg;
+    mock.waiting = false;
+}
+
+
+/*===============================================================*/
+/*Table Input                                                    */
+/*===============================================================*/
+
+/*
+ *@brief  Reads the tables from stdin, returns the number of tables or 0 on a format error
+ */
+
+static uint32_t read_tables(bool exchange){
+
+    char line[128];
+    uint32_t n = 0U;
+    uint32_t used = 0U;
+    uint32_t size, i;
+    spi_sequence_t *t;
+    char *p;
+
+    while (fgets(line, sizeof(line), stdin) != NULL) {
+        for (p = line, size = 0U; isxdigit((unsigned char)p[0]) && isxdigit((unsigned char)p[1]); p += 2) {
+            if ((size >= SEQ_REF_MAX_SIZE) || (used + size >= sizeof(tx))) {
+                return 0U;
+            }
+            tx[used + size++] = (uint8_t)strtoul((char[3]){ p[0], p[1], 0 }, NULL, 16);
+        }
+
+        if (size == 0U) {
+            // Blank line, the next word starts a new table
+            if ((n > 0U) && (tables[n - 1U].count > 0U) && (n < SEQ_REF_MAX_TABLES)) {
+                tables[n++].count = 0U;
+            }
+            continue;
+        }
+
+        if (n == 0U) {
+            n = 1U;
+        }
+        t = &tables[n - 1U];
+        if (t->count == 0U) {
+            t->words = &tx[used];
+            t->size  = (uint8_t)size;
+            t->rx    = exchange ? &rx[used] : NULL;
+        }
+        else if ((t->size != size) || (t->count == 255U)) {
+            return 0U;
+        }
+        t->count++;
+        used += size;
+    }
+
+    if ((n > 0U) && (tables[n - 1U].count == 0U)) {
+        n--;
+    }
+    for (i = 0U; i < n; i++) {
+        if (tables[i].count == 0U) {
+            return 0U;
+        }
+    }
+
+    return n;
+}
+
+
+/*===============================================================*/
+/*Main                                                           */
+/*===============================================================*/
+
+int main(int argc, char *argv[]){
+
+    static const SPIConfig cfg = { spi_sequence_end_cb };
+    static SPIDriver drv = { &cfg };
+    const spi_sequence_stats_t *stats = spi_sequence_get_stats();
+    const uint8_t *expect = tx;
+    uint32_t tables_n, words = 0U;
+    uint32_t i, t, k;
+    uint64_t bit_ns = 0U;
+    bool exchange = false;
+    bool ok;
+
+    if ((argc > 1) && (strcmp(argv[1], "-x") == 0)) {
+        exchange = true;
+        argc--;
+        argv++;
+    }
+
+    if ((argc < 2) || (argc > 4)) {
+        fprintf(stderr, "usage: spi_sequence_ref [-x] clock_hz [isr_ns [cs_ns]] < tables.txt\n");
+        return 2;
+    }
+
+    mock.clock_hz = (uint32_t)strtoul(argv[1], NULL, 0);
+    mock.isr_ns   = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : SEQ_REF_ISR_NS;
+    mock.cs_ns    = (argc > 3) ? (uint32_t)strtoul(argv[3], NULL, 0) : SEQ_REF_CS_NS;
+    if (mock.clock_hz == 0U) {
+        fprintf(stderr, "clock out of range\n");
+        return 2;
+    }
+
+    tables_n = read_tables(exchange);
+    if (tables_n == 0U) {
+        fprintf(stderr, "no tables or bad table format\n");
+        return 2;
+    }
+
+    for (t = 0U; t < tables_n; t++) {
+        words += tables[t].count;
+    }
+
+    spi_sequence_send(&drv, tables, (uint8_t)tables_n);
+
+    ok = !mock.error && !mock.selected && !mock.pending && (mock.frames == words) &&
+         (stats->words == words) && (stats->sequences == 1U);
+
+    printf("word table bytes        select_ns    sent_ns unselect_ns\n");
+    for (i = 0U, t = 0U, k = 0U; i < mock.frames; i++) {
+        const seq_ref_word_t *w = &record[i];
+        char hex[2U * SEQ_REF_MAX_SIZE + 1U];
+        uint32_t b;
+
+        while ((t < tables_n) && (k >= tables[t].count)) {
+            t++;
+            k = 0U;
+        }
+        for (b = 0U; b < w->size; b++) {
+            sprintf(&hex[2U * b], "%02X", w->bytes[b]);
+        }
+
+        if ((t >= tables_n) || (w->size != tables[t].size) || (memcmp(w->bytes, expect, w->size) != 0)) {
+            ok = false;
+        }
+        if (exchange && (t < tables_n) && (memcmp(tables[t].rx + (k * w->size), w->bytes, w->size) != 0)) {
+            ok = false;
+        }
+
+        printf("%4u %5u %-16s %8llu %10llu %11llu\n", (unsigned)i, (unsigned)t, hex,
+               (unsigned long long)w->select, (unsigned long long)w->sent, (unsigned long long)w->unselect);
+        bit_ns += w->sent - w->select;
+        expect += w->size;
+        k++;
+    }
+
+    if (mock.frames > 0U) {
+        printf("%u words in %llu ns, %llu ns per word, bus busy %llu%%\n", (unsigned)mock.frames,
+               (unsigned long long)record[mock.frames - 1U].unselect,
+               (unsigned long long)(record[mock.frames - 1U].unselect / mock.frames),
+               (unsigned long long)((100U * bit_ns) / (record[mock.frames - 1U].unselect + 1U)));
+    }
+    printf("%s\n", ok ? "PASS" : "FAIL");
+
+    return ok ? 0 : 1;
+}
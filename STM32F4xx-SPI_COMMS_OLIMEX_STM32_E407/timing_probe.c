@@ -0,0 +1,78 @@
+/// @file timing_probe.c
+/// @brief Phase timing probes on the DWT cycle counter
+///
+/// PROBE_BEGIN()/PROBE_END() store a name pointer and a CYCCNT stamp into a static
+/// ring buffer, cheap enough to stay enabled in production builds. The report pairs
+/// every end with its start and prints the phase durations, e.g. over USART6.
+///
+/// On ports without a realtime counter (the host simulator) the system time is used,
+/// with tick resolution.
+///
+/// @author Peter Ludlow
+
+#include <string.h>
+#include "ch.h"
+#include "hal.h"
+#include "chprintf.h"
+#include "timing_probe.h"
+
+timing_probe_t timing_probe_ring[TIMING_PROBE_RING];
+uint32_t timing_probe_head;
+
+
+/*
+ *@brief  Starts the cycle counter, can be called before halInit() so that halInit() itself can be probed
+ *@note   The kernel enables the counter again in chSysInit(), without resetting it
+ */
+
+void timing_probe_init(void){
+
+#if PORT_SUPPORTS_RT
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    timing_probe_head = 0;
+}
+
+/*
+ *@brief  Prints the recorded probes, oldest first, with the duration of each begin/end pair
+ */
+
+void timing_probe_report(BaseSequentialStream *chp){
+
+    uint32_t head = timing_probe_head;
+    uint32_t first = (head > TIMING_PROBE_RING) ? (head - TIMING_PROBE_RING) : 0U;
+    const timing_probe_t *p, *b;
+    rtcnt_t t0, d;
+    uint32_t i, j;
+
+    if (head == 0U) {
+        return;
+    }
+    t0 = timing_probe_ring[first & (TIMING_PROBE_RING - 1U)].stamp;
+
+    chprintf(chp, "\r\nTiming probes (%u Hz time base)\r\n", (uint32_t)TIMING_PROBE_FREQ);
+
+    for (i = first; i < head; i++) {
+        p = &timing_probe_ring[i & (TIMING_PROBE_RING - 1U)];
+        chprintf(chp, "%10u us  %-5s %s",
+                 (uint32_t)(((uint64_t)(p->stamp - t0) * 1000000U) / TIMING_PROBE_FREQ),
+                 (p->kind == TIMING_PROBE_BEGIN) ? "begin" : ((p->kind == TIMING_PROBE_END) ? "end" : "mark"),
+                 p->name);
+
+        // Duration of a phase, from the last start of the same name
+        if (p->kind == TIMING_PROBE_END) {
+            for (j = i; j-- > first; ) {
+                b = &timing_probe_ring[j & (TIMING_PROBE_RING - 1U)];
+                if ((b->kind == TIMING_PROBE_BEGIN) && (strcmp(b->name, p->name) == 0)) {
+                    d = p->stamp - b->stamp;
+                    chprintf(chp, "  %u us (%u cycles)",
+                             (uint32_t)(((uint64_t)d * 1000000U) / TIMING_PROBE_FREQ), (uint32_t)d);
+                    break;
+                }
+            }
+        }
+        chprintf(chp, "\r\n");
+    }
+}
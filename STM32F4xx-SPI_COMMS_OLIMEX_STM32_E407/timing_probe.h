@@ -0,0 +1,75 @@
+/// @file timing_probe.h
+/// @brief Variable/Function Declarations - Phase timing probes on the DWT cycle counter
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+#include "hal.h"
+#include "global.h"
+
+/// Number of probe records kept, power of two, the oldest records are overwritten
+#if !defined(TIMING_PROBE_RING)
+#define TIMING_PROBE_RING       64U
+#endif
+
+/*
+ * Probe time base - DWT CYCCNT through the realtime counter, system ticks on ports without it (simulator)
+ */
+#if PORT_SUPPORTS_RT
+#define TIMING_PROBE_NOW()      chSysGetRealtimeCounterX()
+#define TIMING_PROBE_FREQ       STM32_HCLK
+#else
+#define TIMING_PROBE_NOW()      ((rtcnt_t)chVTGetSystemTimeX())
+#define TIMING_PROBE_FREQ       CH_CFG_ST_FREQUENCY
+#endif
+
+/*
+ * Probe record kinds
+ */
+#define TIMING_PROBE_BEGIN      0U      ///< Phase start
+#define TIMING_PROBE_END        1U      ///< Phase end, paired with the last unpaired start of the same name
+#define TIMING_PROBE_MARK       2U      ///< Single event
+
+/*
+ * Probe record
+ */
+typedef struct {
+    const char *name;       ///< Phase name, must be a string literal or otherwise static
+    rtcnt_t     stamp;      ///< Time base value
+    uint8_t     kind;       ///< TIMING_PROBE_BEGIN/END/MARK
+} timing_probe_t;
+
+extern timing_probe_t timing_probe_ring[TIMING_PROBE_RING];
+extern uint32_t timing_probe_head;
+
+/*
+ *@brief  Records a probe, a few instructions
+ *@note   Not serialized, concurrent probes from threads and ISRs may share a slot
+ */
+
+static inline void timing_probe(const char *name, uint8_t kind){
+
+    timing_probe_t *p = &timing_probe_ring[timing_probe_head++ & (TIMING_PROBE_RING - 1U)];
+
+    p->stamp = TIMING_PROBE_NOW();
+    p->name  = name;
+    p->kind  = kind;
+}
+
+#if TIMING_PROBES
+#define PROBE_BEGIN(name)       timing_probe((name), TIMING_PROBE_BEGIN)
+#define PROBE_END(name)         timing_probe((name), TIMING_PROBE_END)
+#define PROBE_MARK(name)        timing_probe((name), TIMING_PROBE_MARK)
+#else
+#define PROBE_BEGIN(name)       ((void)0)
+#define PROBE_END(name)         ((void)0)
+#define PROBE_MARK(name)        ((void)0)
+#endif
+
+/*
+ * Function declarations
+ */
+void timing_probe_init(void);
+void timing_probe_report(BaseSequentialStream *chp);
@@ -0,0 +1,154 @@
+/// @file triangle.c
+/// @brief Range and radial speed from paired up/down sweeps of a triangular ramp
+///
+/// Runs the sweep processing of triangle_sweep.c on the capture: the capture is started
+/// on the ramp complete edges of the continuous triangular ramp, every chirp it hands
+/// out is one sweep, queued to the processing thread, and every completed sweep pair is
+/// broadcast with TRI_RESULT_READY.
+///
+/// A sweep overwritten in the capture before it was processed breaks the alternation of
+/// up and down sweeps, the pairing is restarted with the next one.
+///
+/// @author Peter Ludlow
+
+#include "ch.h"
+#include "hal.h"
+#include "triangle.h"
+#include "timing_probe.h"
+
+
+/*===============================================================*/
+/*Thread State                                                   */
+/*===============================================================*/
+
+static struct {
+    uint32_t         decim;             // Decimation, 1 for none
+    uint32_t         overruns;          // Capture overruns seen so far
+    adc_chirp_t      queue[2];          // Sweeps waiting for the processing thread
+    uint32_t         head;
+    uint32_t         tail;
+    semaphore_t      pending;           // Counts the queued sweeps
+    bool             started;           // Thread created
+} tri;
+
+static EVENTSOURCE_DECL(tri_source);    // Broadcast TRI_RESULT_READY with every result
+
+static THD_WORKING_AREA(tri_wa, 512);
+
+
+/*===============================================================*/
+/*Processing Thread                                              */
+/*===============================================================*/
+
+/*
+ *@brief  Chirp callback of the capture, queues the sweep for the processing thread
+ *@note   A half handed out again while still queued has been overwritten, it is not queued twice
+ */
+
+static void tri_chirp_cb(const adc_chirp_t *chirp){
+
+    if ((tri.head - tri.tail) >= 2U) {
+        return;
+    }
+
+    tri.queue[tri.head++ & 1U] = *chirp;
+    chSemSignalI(&tri.pending);
+}
+
+/*
+ *@brief  Sweep processing thread
+ */
+
+static THD_FUNCTION(tri_thread, arg){
+
+    adc_chirp_t c;
+    rtcnt_t t;
+    uint32_t overruns;
+    bool done;
+
+    (void)arg;
+    chRegSetThreadName("triangle");
+
+    while (true) {
+        if (chSemWait(&tri.pending) != MSG_OK) {
+            continue;
+        }
+
+        chSysLock();
+        c = tri.queue[tri.tail++ & 1U];
+        chSysUnlock();
+
+        // A sweep overwritten in the capture is skipped, the pairing restarts with the next one
+        overruns = adc_capture_get_stats()->overruns;
+        if (overruns != tri.overruns) {
+            tri.overruns = overruns;
+            tri_restart();
+            adc_capture_release(c.buf);
+            continue;
+        }
+
+        t = TIMING_PROBE_NOW();
+        done = tri_sweep(c.buf, c.ramp, c.stamp);
+        adc_capture_release(c.buf);
+        tri_set_time(TIMING_PROBE_NOW() - t);
+
+        if (done) {
+            chEvtBroadcastFlags(&tri_source, TRI_RESULT_READY);
+        }
+    }
+}
+
+/*
+ *@brief  Starts the capture on the ramp complete edges and the sweep processing, returns false if the configuration is not supported
+ *@note   The ADF4159 must run the triangular ramp with MUXOUT = ramp complete. The thread is created by the first call
+ */
+
+bool tri_start(const tri_config_t *cfg){
+
+    static adc_capture_config_t capture_cfg;
+
+    tri.decim = (cfg->decim > 1U) ? cfg->decim : 1U;
+    if (((cfg->range_n * tri.decim) > ADC_CAPTURE_MAX_SAMPLES) || !tri_init(cfg)) {
+        return false;
+    }
+
+    tri.head = 0U;
+    tri.tail = 0U;
+    tri.overruns = adc_capture_get_stats()->overruns;
+
+    if (!tri.started) {
+        tri.started = true;
+        chSemObjectInit(&tri.pending, 0);
+        (void) chThdCreateStatic(tri_wa, sizeof(tri_wa), TRI_THREAD_PRIO, tri_thread, NULL);
+    }
+    else {
+        chSemReset(&tri.pending, 0);
+    }
+
+    capture_cfg.samples      = cfg->range_n * tri.decim;
+    capture_cfg.cb           = tri_chirp_cb;
+    capture_cfg.period_us    = cfg->period_us;
+    capture_cfg.ramp_trigger = true;
+    capture_cfg.triangle     = true;
+    adc_capture_start(&capture_cfg);
+
+    return true;
+}
+
+/*
+ *@brief  Stops the capture, the result keeps the last pair
+ */
+
+void tri_stop(void){
+
+    adc_capture_stop();
+}
+
+/*
+ *@brief  Returns the event source broadcast with TRI_RESULT_READY after every pair
+ */
+
+event_source_t *tri_get_source(void){
+
+    return &tri_source;
+}
@@ -0,0 +1,26 @@
+/// @file triangle.h
+/// @brief Variable/Function Declarations - Range and radial speed from paired up/down sweeps of a triangular ramp
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include "ch.h"
+#include "hal.h"
+#include "adc_capture.h"
+#include "triangle_sweep.h"
+
+/// Priority of the sweep processing thread, it must keep up with the ramps
+#if !defined(TRI_THREAD_PRIO)
+#define TRI_THREAD_PRIO         (NORMALPRIO + 1)
+#endif
+
+/// Event flag broadcast with the result ready event source
+#define TRI_RESULT_READY        1U
+
+/*
+ * Function declarations
+ */
+bool tri_start(const tri_config_t *cfg);
+void tri_stop(void);
+event_source_t *tri_get_source(void);
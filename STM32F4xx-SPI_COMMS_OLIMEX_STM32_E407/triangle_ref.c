@@ -0,0 +1,202 @@
+/// @file triangle_ref.c
+/// @brief Host reference build of the triangular ramp sweep processing, not part of the firmware
+///
+/// Runs the same triangle_sweep.c on a PC over synthetic up/down sweeps of three moving
+/// targets and checks the paired ranges and speeds:
+///
+///   gcc -O2 -o triangle_ref triangle_ref.c triangle_sweep.c fft.c fft_twiddle.c cfar.c
+///       decim.c decim_fir.c preproc.c preproc_window.c -lm
+///   triangle_ref
+///
+/// Each sweep is 256 sample pairs of three complex tones in noise, at the beat of
+/// synth_targets[] for the sweep direction, with a DC offset on channel A and a phase
+/// step from sweep to sweep. The first sweep is a down sweep, as after the first ramp
+/// complete edge of the ADF4159, so the direction vote has to learn it.
+///
+/// The check runs with the plain conversion and with each window after DC removal, and
+/// with the up sweep beats at positive and at negative frequencies (cfg.up_negative,
+/// the sweeps made with channel B inverted). Every pair must give the three targets and
+/// nothing else, within TRI_REF_TOL_Q8 of their range and Doppler bins. One line per
+/// run and PASS or FAIL are printed, the result is the exit status.
+///
+/// @author Peter Ludlow
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "triangle_sweep.h"
+
+#define TRI_REF_N           256U
+#define TRI_REF_SWEEPS      8U
+
+/// Largest error of a paired target, range and Doppler, FFT bins Q8
+#define TRI_REF_TOL_Q8      32
+
+/// Noise peak to peak and DC offset of channel A, ADC codes
+#define TRI_REF_NOISE       40.0
+#define TRI_REF_DC          300.0
+
+/*
+ * Synthetic target, range and Doppler in FFT bins, amplitude in ADC codes
+ */
+typedef struct {
+    double range;
+    double doppler;
+    double amplitude;
+} tri_ref_target_t;
+
+static const tri_ref_target_t synth_targets[] = {
+    { 20.3,  1.6, 1500.0 },
+    { 50.0, -3.2,  900.0 },
+    { 90.7,  0.0,  600.0 },
+};
+
+#define TRI_REF_TARGETS     (sizeof(synth_targets) / sizeof(synth_targets[0]))
+
+static uint16_t buf[2U * TRI_REF_N];
+static uint32_t rnd;
+
+
+/*
+ *@brief  Uniform noise in -0.5 .. 0.5, reproducible across hosts
+ */
+
+static double noise(void){
+
+    rnd = (rnd * 1103515245U) + 12345U;
+    return (double)((rnd >> 16) & 0x7FFFU) / 32768.0 - 0.5;
+}
+
+/*
+ *@brief  Makes one sweep of sample pairs, offset binary, channel A then channel B
+ */
+
+static void synth_sweep(uint32_t ramp, bool down, bool up_negative){
+
+    uint32_t i, t;
+    double re, im, f, ph;
+
+    for (i = 0U; i < TRI_REF_N; i++) {
+        re = 0.0;
+        im = 0.0;
+        for (t = 0U; t < TRI_REF_TARGETS; t++) {
+            f = down ? -(synth_targets[t].range + synth_targets[t].doppler) :
+                       (synth_targets[t].range - synth_targets[t].doppler);
+            ph = ((2.0 * M_PI * f * i) / TRI_REF_N) + (ramp * 0.7);
+            re += synth_targets[t].amplitude * cos(ph);
+            im += synth_targets[t].amplitude * sin(ph);
+        }
+        if (up_negative) {
+            im = -im;
+        }
+        re += TRI_REF_NOISE * noise();
+        im += TRI_REF_NOISE * noise();
+        buf[2U * i]        = (uint16_t)lround(8192.0 + TRI_REF_DC + re);
+        buf[(2U * i) + 1U] = (uint16_t)lround(8192.0 + im);
+    }
+}
+
+/*
+ *@brief  Checks a pair result against the synthetic targets
+ */
+
+static bool check_result(const tri_result_t *res){
+
+    uint32_t t, k;
+    int32_t range, doppler;
+
+    if (res->count != TRI_REF_TARGETS) {
+        return false;
+    }
+
+    for (t = 0U; t < TRI_REF_TARGETS; t++) {
+        range   = (int32_t)lround(synth_targets[t].range * 256.0);
+        doppler = (int32_t)lround(synth_targets[t].doppler * 256.0);
+        for (k = 0U; k < res->count; k++) {
+            if ((abs(res->target[k].range_q8 - range) <= TRI_REF_TOL_Q8) &&
+                (abs(res->target[k].doppler_q8 - doppler) <= TRI_REF_TOL_Q8)) {
+                break;
+            }
+        }
+        if (k == res->count) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+ *@brief  Runs the sweeps through one configuration, returns true when every pair passes
+ */
+
+static bool run(const pre_config_t *pre, bool up_negative, const char *name){
+
+    static const cfar_config_t cfar = { CFAR_OS, 2U, 8U, 12U, CFAR_SCALE(4.0), true };
+    const tri_result_t *res = tri_get_result();
+    tri_config_t cfg = {
+        .range_n        = TRI_REF_N,
+        .decim          = 1U,
+        .bins           = TRI_REF_N / 2U,
+        .cfar           = &cfar,
+        .pre            = pre,
+        .sample_hz      = 10000000U,
+        .bandwidth_hz   = 250000000U,
+        .duration_ns    = 25600U,
+        .carrier_hz     = 24125000000ULL,
+        .max_speed_mm_s = 1000000U,
+        .up_negative    = up_negative,
+    };
+    uint32_t ramp, k, pairs = 0U, good = 0U;
+    double err_r = 0.0, err_d = 0.0;
+
+    if (!tri_init(&cfg)) {
+        printf("%-10s %s  unsupported configuration\n", name, up_negative ? "neg" : "pos");
+        return false;
+    }
+
+    rnd = 12345U;
+    for (ramp = 0U; ramp < TRI_REF_SWEEPS; ramp++) {
+        synth_sweep(ramp, (ramp & 1U) == 0U, up_negative);
+        if (!tri_sweep(buf, ramp, ramp)) {
+            continue;
+        }
+        pairs++;
+        if (check_result(res)) {
+            good++;
+        }
+        for (k = 0U; (k < res->count) && (k < TRI_REF_TARGETS); k++) {
+            err_r = fmax(err_r, fabs((res->target[k].range_q8 / 256.0) - synth_targets[k].range));
+            err_d = fmax(err_d, fabs((res->target[k].doppler_q8 / 256.0) - synth_targets[k].doppler));
+        }
+    }
+
+    printf("%-10s %s  %u/%u pairs, worst error %.3f range bin %.3f Doppler bin, %u mm %d mm/s\n",
+           name, up_negative ? "neg" : "pos", (unsigned)good, (unsigned)pairs, err_r, err_d,
+           (unsigned)res->target[0].range_mm, (int)res->target[0].speed_mm_s);
+
+    return (pairs == (TRI_REF_SWEEPS - 1U)) && (good == pairs);
+}
+
+int main(void){
+
+    static const pre_config_t pre[3] = {
+        { PRE_DC_CHIRP, false, 0, 0, PRE_WINDOW_NONE },
+        { PRE_DC_CHIRP, false, 0, 0, PRE_WINDOW_HANN },
+        { PRE_DC_CHIRP, false, 0, 0, PRE_WINDOW_BLACKMAN },
+    };
+    static const char *const names[3] = { "dc", "hann", "blackman" };
+    uint32_t i, s;
+    bool ok = true;
+
+    for (s = 0U; s < 2U; s++) {
+        ok = run(NULL, s != 0U, "plain") && ok;
+        for (i = 0U; i < 3U; i++) {
+            ok = run(&pre[i], s != 0U, names[i]) && ok;
+        }
+    }
+
+    printf("%s\n", ok ? "PASS" : "FAIL");
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,357 @@
+/// @file triangle_sweep.c
+/// @brief Sweep processing and up/down pairing of a triangular ramp
+///
+/// With the continuous triangular ramp every ramp complete edge starts a sweep of the
+/// other direction. A target at range beat frequency fr moving at Doppler shift fd gives
+/// a beat at fr - fd on the up sweep and fr + fd on the down sweep, mirrored to negative
+/// frequencies by the quadrature mixer. Pairing the peaks of two consecutive sweeps
+/// gives fr = (fup + fdown) / 2 and fd = (fdown - fup) / 2, range and radial speed from
+/// a single triangle instead of a Doppler FFT over a frame of chirps.
+///
+/// This file holds the processing of the sweeps, with no RTOS or peripheral dependency
+/// so it runs unchanged in the host reference build triangle_ref.c; triangle.c feeds it
+/// from the capture in its own thread.
+///
+/// Each sweep is converted to Q15, optionally decimated and preprocessed, and
+/// transformed in place. The up sweep profile is the half of the spectrum holding the
+/// up sweep beats, the positive half unless cfg->up_negative is set, the down sweep
+/// profile the other half mirrored, so both hold the peak of a target at a positive
+/// bin. Peaks are found by CFAR past the DC bin and refined to 1/256 bin from the
+/// levels of their neighbours, with the estimator of the window in use.
+///
+/// The sweep direction follows from the ramp number the capture puts on each chirp,
+/// counting the ramp complete edges: even and odd ramps alternate. Which of them is the
+/// up sweep depends on the slope running when the capture started, MUXOUT does not tell,
+/// so it is learned from the data - an up sweep has its targets on the up sweep side of
+/// the spectrum. Sweeps with clearly more energy on one side vote for the assignment.
+///
+/// Peaks are paired strongest first, each up sweep peak with the down sweep peak of
+/// closest level within the speed window and TRI_PAIR_LEVEL_RATIO.
+///
+/// @author Peter Ludlow
+
+#include <stddef.h>
+#include "triangle_sweep.h"
+#include "decim.h"
+
+// Speed of light (m/s)
+#define TRI_C                   299792458ULL
+
+// Saturation of the direction vote, the number of contrary sweeps needed to flip an established assignment
+#define TRI_VOTE_MAX            16
+
+#define TRI_MAX_BINS            (FFT_MAX_POINTS / 2U)
+
+// Plain offset binary to Q15 conversion, the fused pass with every option off
+static const pre_config_t tri_plain = { PRE_DC_NONE, false, 0, 0, PRE_WINDOW_NONE };
+
+
+/*===============================================================*/
+/*Sweep State                                                    */
+/*===============================================================*/
+
+typedef struct {
+    int32_t  pos;           // Peak position, FFT bins Q8
+    uint16_t level;         // Peak level
+} tri_peak_t;
+
+typedef struct {
+    tri_peak_t peak[CFAR_MAX_DETECTIONS];
+    uint32_t   count;
+    uint32_t   ramp;        // Ramp number
+    bool       up;          // Up sweep
+    bool       valid;
+} tri_sweep_t;
+
+static struct {
+    tri_config_t     cfg;
+    uint32_t         decim;             // Decimation, 1 for none
+    uint32_t         um_per_bin;        // Range per beat bin (um)
+    uint32_t         mm_s_per_bin;      // Radial speed per Doppler bin (mm/s)
+    int32_t          max_doppler_q8;    // Pairing window, Doppler shift in FFT bins Q8
+    int32_t          vote;              // Direction vote, negative when odd ramps are up sweeps
+    tri_sweep_t      sweep[2];          // Last two sweeps, by ramp number parity
+} tri;
+
+static uint16_t tri_up[TRI_MAX_BINS];   // Magnitudes of the up sweep side of the spectrum
+static uint16_t tri_down[TRI_MAX_BINS]; // Magnitudes of the down sweep side, mirrored
+static cfar_list_t tri_peaks;
+
+static tri_result_t result;
+static tri_stats_t stats;
+
+
+/*===============================================================*/
+/*Processing Steps                                               */
+/*===============================================================*/
+
+/*
+ *@brief  Peak position in Q8 bins, from the level of the larger neighbour relative to the peak
+ *@note   A tone delta bins off bin k gives a neighbour ratio a = |X[k + 1]| / |X[k]| of delta / (1 - delta) unwindowed,
+ *        (1 + delta) / (2 - delta) with the Hann window, so delta = ((v + 1) * a - v) / (a + 1) with v = 0 and 1.
+ *        v = 2 approximates the Blackman window to within 0.1 bin
+ */
+
+static int32_t tri_interpolate(const uint16_t *m, uint32_t k){
+
+    uint32_t l, c, r;
+    int32_t v = (tri.cfg.pre != NULL) ? (int32_t)tri.cfg.pre->window : 0;
+    int32_t d;
+
+    if ((k == 0U) || (k >= (tri.cfg.bins - 1U))) {
+        return (int32_t)(k << 8);
+    }
+
+    l = m[k - 1U];
+    c = m[k];
+    r = m[k + 1U];
+
+    if (r > l) {
+        d = ((((v + 1) * (int32_t)r) - (v * (int32_t)c)) * 256) / (int32_t)(c + r);
+        return (int32_t)(k << 8) + ((d > 0) ? d : 0);
+    }
+
+    d = ((((v + 1) * (int32_t)l) - (v * (int32_t)c)) * 256) / (int32_t)(c + l);
+    return (int32_t)(k << 8) - ((d > 0) ? d : 0);
+}
+
+/*
+ *@brief  Pairs the peaks of an up and a down sweep into the result
+ */
+
+static void tri_pair(const tri_sweep_t *up, const tri_sweep_t *down){
+
+    bool done[CFAR_MAX_DETECTIONS];
+    bool used[CFAR_MAX_DETECTIONS];
+    const tri_peak_t *u, *d;
+    tri_target_t *t;
+    uint32_t i, j, best_i, best_j, cost, best_cost;
+    int32_t diff;
+
+    for (i = 0U; i < CFAR_MAX_DETECTIONS; i++) {
+        done[i] = false;
+        used[i] = false;
+    }
+
+    result.count = 0U;
+
+    for (;;) {
+        // Strongest up sweep peak not yet tried
+        best_i = CFAR_MAX_DETECTIONS;
+        for (i = 0U; i < up->count; i++) {
+            if (!done[i] && ((best_i == CFAR_MAX_DETECTIONS) || (up->peak[i].level > up->peak[best_i].level))) {
+                best_i = i;
+            }
+        }
+        if (best_i == CFAR_MAX_DETECTIONS) {
+            break;
+        }
+        done[best_i] = true;
+        u = &up->peak[best_i];
+
+        // Down sweep peak of closest level within the speed window
+        best_j = CFAR_MAX_DETECTIONS;
+        best_cost = UINT32_MAX;
+        for (j = 0U; j < down->count; j++) {
+            d = &down->peak[j];
+            diff = d->pos - u->pos;
+            if (used[j] || (diff > (2 * tri.max_doppler_q8)) || (diff < (-2 * tri.max_doppler_q8)) ||
+                ((uint32_t)u->level > (TRI_PAIR_LEVEL_RATIO * d->level)) ||
+                ((uint32_t)d->level > (TRI_PAIR_LEVEL_RATIO * u->level))) {
+                continue;
+            }
+            cost = (u->level > d->level) ? (uint32_t)(u->level - d->level) : (uint32_t)(d->level - u->level);
+            if (cost < best_cost) {
+                best_cost = cost;
+                best_j = j;
+            }
+        }
+
+        if ((best_j == CFAR_MAX_DETECTIONS) || (result.count >= TRI_MAX_TARGETS)) {
+            stats.unpaired++;
+            continue;
+        }
+        used[best_j] = true;
+        d = &down->peak[best_j];
+
+        t = &result.target[result.count++];
+        t->range_q8   = (u->pos + d->pos) / 2;
+        t->doppler_q8 = (d->pos - u->pos) / 2;
+        t->range_mm   = (uint32_t)(((int64_t)t->range_q8 * tri.um_per_bin) / 256000);
+        t->speed_mm_s = (int32_t)(((int64_t)t->doppler_q8 * tri.mm_s_per_bin) / 256);
+        t->level      = (uint16_t)(((uint32_t)u->level + d->level) / 2U);
+    }
+
+    for (j = 0U; j < down->count; j++) {
+        if (!used[j]) {
+            stats.unpaired++;
+        }
+    }
+
+    stats.targets += result.count;
+}
+
+/*
+ *@brief  Sets the sweep processing configuration, returns false if it is not supported
+ */
+
+bool tri_init(const tri_config_t *cfg){
+
+    uint32_t decim = (cfg->decim > 1U) ? cfg->decim : 1U;
+
+    if ((cfg->range_n < FFT_MIN_POINTS) || (cfg->range_n > FFT_MAX_POINTS) || ((cfg->range_n & (cfg->range_n - 1U)) != 0U) ||
+        ((decim > 1U) && !decim_supported(decim)) || (cfg->bins < 2U) || (cfg->bins > (cfg->range_n / 2U)) ||
+        (cfg->cfar == NULL) || (cfg->sample_hz == 0U) || (cfg->bandwidth_hz == 0U) || (cfg->duration_ns == 0U) ||
+        (cfg->carrier_hz == 0U) || ((cfg->pre != NULL) && !pre_supported(cfg->pre, cfg->range_n))) {
+        return false;
+    }
+
+    tri.cfg = *cfg;
+    tri.decim = decim;
+    pre_reset();
+
+    // Range per beat bin, c * fs * T / (2 * B * n), and speed per Doppler bin, c * fs / (2 * fc * n), fs after decimation
+    tri.um_per_bin = (uint32_t)((((TRI_C * cfg->sample_hz) / (2U * (uint64_t)cfg->bandwidth_hz)) * cfg->duration_ns) /
+                                ((uint64_t)cfg->range_n * decim * 1000U));
+    tri.mm_s_per_bin = (uint32_t)((((TRI_C * cfg->sample_hz) / ((uint64_t)cfg->range_n * decim)) * 1000U) / (2U * cfg->carrier_hz));
+    if (tri.mm_s_per_bin == 0U) {
+        return false;
+    }
+    tri.max_doppler_q8 = (int32_t)(((uint64_t)cfg->max_speed_mm_s * 256U) / tri.mm_s_per_bin);
+
+    tri.vote = 0;
+    tri_restart();
+
+    return true;
+}
+
+/*
+ *@brief  Processes one sweep, returns true when it completed a pair and the result was updated
+ *@note   buf holds range_n * decim captured sample pairs (adc_sample_t) and is processed in place
+ */
+
+bool tri_sweep(void *buf, uint32_t ramp, uint32_t stamp){
+
+    cq15_t *x = (cq15_t *)buf;
+    uint32_t n = tri.cfg.range_n;
+    uint32_t k, i;
+    uint32_t up_sum = 0U;
+    uint32_t down_sum = 0U;
+    bool even_up, up;
+    const uint16_t *m;
+    tri_sweep_t *s = &tri.sweep[ramp & 1U];
+    tri_sweep_t *prev = &tri.sweep[(ramp & 1U) ^ 1U];
+
+    if (tri.decim > 1U) {
+        (void) decim_to_q15(buf, n * tri.decim, tri.decim);
+        if (tri.cfg.pre != NULL) {
+            pre_q15(buf, n, tri.cfg.pre);
+        }
+    }
+    else {
+        pre_to_q15(buf, n, (tri.cfg.pre != NULL) ? tri.cfg.pre : &tri_plain);
+    }
+    (void) fft_cfft_q15(x, n);
+
+    for (k = 0U; k < tri.cfg.bins; k++) {
+        tri_up[k]   = fft_mag_q15(x[tri.cfg.up_negative ? ((n - k) & (n - 1U)) : k]);
+        tri_down[k] = fft_mag_q15(x[tri.cfg.up_negative ? k : ((n - k) & (n - 1U))]);
+        if (k != 0U) {
+            up_sum   += tri_up[k];
+            down_sum += tri_down[k];
+        }
+    }
+
+    // Direction vote, an up sweep has its targets on the up sweep side
+    even_up = (tri.vote >= 0);
+    if (up_sum > (2U * down_sum)) {
+        tri.vote += ((ramp & 1U) == 0U) ? 1 : -1;
+    }
+    else if (down_sum > (2U * up_sum)) {
+        tri.vote += ((ramp & 1U) == 0U) ? -1 : 1;
+    }
+    if (tri.vote > TRI_VOTE_MAX) {
+        tri.vote = TRI_VOTE_MAX;
+    }
+    if (tri.vote < -TRI_VOTE_MAX) {
+        tri.vote = -TRI_VOTE_MAX;
+    }
+    if ((tri.vote >= 0) != even_up) {
+        stats.flips++;
+    }
+    up = ((ramp & 1U) == 0U) == (tri.vote >= 0);
+
+    m = up ? tri_up : tri_down;
+    (void) cfar_range(m, tri.cfg.bins, tri.cfg.cfar, &tri_peaks);
+
+    // The DC bin holds what is left of the ADC offset, not a target
+    s->count = 0U;
+    for (i = 0U; i < tri_peaks.count; i++) {
+        if (tri_peaks.det[i].bin == 0U) {
+            continue;
+        }
+        s->peak[s->count].pos   = tri_interpolate(m, tri_peaks.det[i].bin);
+        s->peak[s->count].level = tri_peaks.det[i].level;
+        s->count++;
+    }
+    s->ramp  = ramp;
+    s->up    = up;
+    s->valid = true;
+    stats.sweeps++;
+
+    if (!prev->valid || (prev->ramp != (ramp - 1U)) || (prev->up == up)) {
+        stats.gaps++;
+        return false;
+    }
+
+    if (up) {
+        tri_pair(s, prev);
+    }
+    else {
+        tri_pair(prev, s);
+    }
+    result.ramp  = ramp;
+    result.stamp = stamp;
+    stats.pairs++;
+
+    return true;
+}
+
+/*
+ *@brief  Restarts the pairing, the next sweep has no predecessor
+ *@note   Called when a sweep was lost, the direction vote is kept
+ */
+
+void tri_restart(void){
+
+    tri.sweep[0].valid = false;
+    tri.sweep[1].valid = false;
+}
+
+/*
+ *@brief  Records the processing time of the last sweep, measured by the caller
+ */
+
+void tri_set_time(uint32_t time){
+
+    stats.time = time;
+}
+
+/*
+ *@brief  Returns the targets of the last sweep pair
+ *@note   Read it on TRI_RESULT_READY, it is rewritten by the next pair
+ */
+
+const tri_result_t *tri_get_result(void){
+
+    return &result;
+}
+
+/*
+ *@brief  Returns the processing statistics
+ */
+
+const tri_stats_t *tri_get_stats(void){
+
+    return &stats;
+}
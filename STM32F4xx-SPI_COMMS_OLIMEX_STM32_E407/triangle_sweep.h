@@ -0,0 +1,84 @@
+/// @file triangle_sweep.h
+/// @brief Variable/Function Declarations - Sweep processing and up/down pairing of a triangular ramp
+///
+/// @author Peter Ludlow
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "fft.h"
+#include "cfar.h"
+#include "preproc.h"
+
+/// Targets reported per sweep pair
+#if !defined(TRI_MAX_TARGETS)
+#define TRI_MAX_TARGETS         16U
+#endif
+
+/// Largest level ratio between the up and down sweep peaks of one target
+#if !defined(TRI_PAIR_LEVEL_RATIO)
+#define TRI_PAIR_LEVEL_RATIO    2U
+#endif
+
+/*
+ * Sweep processing configuration, frequencies at the multiplied output
+ */
+typedef struct {
+    uint32_t             range_n;           ///< FFT size = sample pairs per sweep after decimation, power of two FFT_MIN_POINTS .. FFT_MAX_POINTS
+    uint32_t             decim;             ///< Decimation ahead of the FFT, 0 or 1 for none, else DECIM_MIN .. DECIM_MAX
+    uint32_t             bins;              ///< Beat bins searched, at most range_n / 2
+    const cfar_config_t *cfar;              ///< Peak detector run on each sweep
+    const pre_config_t  *pre;               ///< DC, I/Q and window preprocessing of each sweep, NULL for the plain Q15 conversion
+    uint32_t             sample_hz;         ///< AD9648 encode rate, before decimation
+    uint32_t             bandwidth_hz;      ///< Sweep bandwidth of one slope
+    uint32_t             duration_ns;       ///< Duration of one slope
+    uint64_t             carrier_hz;        ///< Centre frequency of the sweep
+    uint32_t             max_speed_mm_s;    ///< Largest radial speed paired
+    bool                 up_negative;       ///< Up sweep beats at negative frequencies, false when the up sweep beat is positive (I on channel A leading Q)
+    uint32_t             period_us;         ///< Ramp period, capture simulator only
+} tri_config_t;
+
+/*
+ * One target of a sweep pair, positive speeds approach
+ */
+typedef struct {
+    int32_t  range_q8;      ///< Range beat frequency, FFT bins Q8
+    int32_t  doppler_q8;    ///< Doppler shift, FFT bins Q8
+    uint32_t range_mm;      ///< Range
+    int32_t  speed_mm_s;    ///< Radial speed
+    uint16_t level;         ///< Mean peak level of the two sweeps
+} tri_target_t;
+
+/*
+ * Targets of the last sweep pair, strongest first
+ */
+typedef struct {
+    uint32_t     ramp;                      ///< Ramp number of the later sweep
+    uint32_t     stamp;                     ///< Start of the later sweep (TIMING_PROBE_FREQ)
+    uint32_t     count;                     ///< Targets in target[]
+    tri_target_t target[TRI_MAX_TARGETS];   ///< Paired targets
+} tri_result_t;
+
+/*
+ * Processing statistics
+ */
+typedef struct {
+    uint32_t sweeps;        ///< Sweeps processed
+    uint32_t pairs;         ///< Sweep pairs, one result each
+    uint32_t targets;       ///< Targets paired
+    uint32_t unpaired;      ///< Peaks left without a partner
+    uint32_t gaps;          ///< Sweeps without a predecessor, a ramp was lost
+    uint32_t flips;         ///< Changes of the up/down assignment of the ramp numbers
+    uint32_t time;          ///< Last sweep, conversion to pairing (TIMING_PROBE_FREQ), set by the caller
+} tri_stats_t;
+
+/*
+ * Function declarations
+ */
+bool tri_init(const tri_config_t *cfg);
+bool tri_sweep(void *buf, uint32_t ramp, uint32_t stamp);
+void tri_restart(void);
+void tri_set_time(uint32_t time);
+const tri_result_t *tri_get_result(void);
+const tri_stats_t *tri_get_stats(void);